@@ -48,8 +48,14 @@ namespace Beam
 //	 const enums::enum_boundary_ids id_boundary_load = enums::id_boundary_yPlus; // load applied on top
 	 const enums::enum_boundary_ids id_boundary_secondaryLoad = enums::id_boundary_none;
 
-	// Characteristic body dimensions
-	 std::vector<double> body_dimensions (5);
+	 struct State
+	 {
+		// Characteristic body dimensions
+		 std::vector<double> body_dimensions = std::vector<double>(5);
+	 };
+	 State example_state;
+
+	 std::vector<double> &body_dimensions = example_state.body_dimensions;
 
 	// Some internal parameters
 	 struct parameterCollection
@@ -63,7 +69,7 @@ namespace Beam
 	template<int dim>
 	void make_constraints ( AffineConstraints<double> &constraints, const FESystem<dim> &fe, unsigned int &n_components, DoFHandler<dim> &dof_handler_ref,
 							const bool &apply_dirichlet_bc, double &current_load_increment, const double &lambda_n,
-							const Parameter::GeneralParameters &parameter )
+							const Parameter::GeneralParameters &parameter, State &state=example_state )
 	{
 		// clamping on X0 plane: set x, y and z displacements on x0 plane to zero
 		 //numEx::BC_apply_fix( enums::id_boundary_xMinus, dof_handler_ref, fe, constraints );
@@ -108,7 +114,7 @@ namespace Beam
 //			}
 
 			// prescribed pseudo pure bending load
-			numEx::BeamEnd<dim> beamEnd (body_dimensions[enums::x], body_dimensions[enums::y], lambda_n, current_load_increment, n_components);
+			numEx::BeamEnd<dim> beamEnd (state.body_dimensions[enums::x], state.body_dimensions[enums::y], lambda_n, current_load_increment, n_components);
 
 			if (apply_dirichlet_bc == true )
 			{
@@ -138,7 +144,7 @@ namespace Beam
 
 	// 2D grid
 	template <int dim>
-	void make_grid( Triangulation<2> &triangulation, const Parameter::GeneralParameters &parameter )
+	void make_grid( Triangulation<2> &triangulation, const Parameter::GeneralParameters &parameter, State &state=example_state )
 	{
 		parameterCollection parameters_internal;
 
@@ -152,9 +158,9 @@ namespace Beam
 		// USER PARAMETERS
 		 double refined_fraction=length/4.;
 
-		body_dimensions[enums::x] = length;
-		body_dimensions[enums::y] = width;
-		body_dimensions[enums::z] = thickness;
+		state.body_dimensions[enums::x] = length;
+		state.body_dimensions[enums::y] = width;
+		state.body_dimensions[enums::z] = thickness;
 
 		// The bar is created from two bricks, where the first will be meshed very fine
 		// and the second remains coarse. The bricks are spanned by three points.
@@ -164,7 +170,8 @@ namespace Beam
 		 Point<dim> p4 (length, width);
 
 
-		 if ( parameter.refine_special == enums::Mesh_refine_beam_fineCoarseBrick )
+		 if ( parameter.refine_special == enums::Mesh_refine_beam_fineCoarseBrick
+			  || parameter.refine_special == enums::Mesh_refine_beam_fineCoarseBrick_minimal )
 		{
 			// Vector containing the number of elements in each dimension
 			// The coarse segment consists of the set number of elements in the y-direction
@@ -177,26 +184,14 @@ namespace Beam
 			 repetitions_fine[enums::x] = 6 * (parameter.nbr_global_refinements+1);
 			 repetitions_fine[enums::y] = 3; // y
 
-			Triangulation<dim> triangulation_fine, triangulation_coarse;
-			// The fine brick
-			 GridGenerator::subdivided_hyper_rectangle ( triangulation_fine,
-														 repetitions_fine,
-														 p1,
-														 p2 );
-
-			// The coarse brick
-			 GridGenerator::subdivided_hyper_rectangle ( triangulation_coarse,
-														 repetitions,
-														 p2,
-														 p3 );
-
-			// Merging fine and coarse brick
+			// Create and merge the fine brick (p1->p2) and the coarse brick (p2->p3)
 			// @note The interface between the two bricks needs to be meshed identically.
 			// deal.II cannot detect hanging nodes there.
-			GridGenerator::merge_triangulations( triangulation_fine,
-												 triangulation_coarse,
-												 triangulation,
-												 1e-9 * length );
+			 numEx::create_merged_bricks<dim>( triangulation,
+											   { {p1,p2}, {p2,p3} },
+											   { repetitions_fine, repetitions },
+											   1e-9 * length,
+											   parameter.refine_special == enums::Mesh_refine_beam_fineCoarseBrick_minimal );
 
 			// Local refinement
 			if ( parameter.nbr_holeEdge_refinements >= 0 && parameter.nbr_global_refinements==0 )
@@ -238,49 +233,13 @@ namespace Beam
 														 p4 );
 		 }
 
-		// Clear all existing boundary ID's
-		 numEx::clear_boundary_IDs( triangulation );
-
-		// Set boundary IDs and manifolds
-		for (typename Triangulation<dim>::active_cell_iterator
-			 cell = triangulation.begin_active();
-			 cell != triangulation.end(); ++cell)
-		{
-			for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-			  if (cell->face(face)->at_boundary())
-			  {
-				//Set boundary IDs
-				if (std::abs(cell->face(face)->center()[0] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_xMinus);
-//					for ( unsigned int vertex=0; vertex < GeometryInfo<dim>::vertices_per_face; ++vertex)
-//					{
-//						if ( cell->face(face)->vertex(vertex).distance(Point<dim> (0,0)) < 1e-10 )
-//						{
-//							cell->face(face)->set_boundary_id(enums::id_boundary_xMinus2);
-//						}
-//					}
-				}
-				else if (std::abs(cell->face(face)->center()[enums::x] - body_dimensions[enums::x]) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_xPlus);
-				}
-				else if (std::abs(cell->face(face)->center()[1] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yMinus);
-//						cell->set_material_id( enums::tracked_QP );
-				}
-				else if (std::abs(cell->face(face)->center()[enums::y] - body_dimensions[enums::y]) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yPlus);
-				}
-//					else
-//					{
-//						// There are just eight faces, so if we missed one, something went clearly terribly wrong
-//						 AssertThrow(false, ExcMessage("Beam - make_grid 2D<< Found an unidentified face at the boundary. Maybe it slipt through the assignment or that face is simply not needed. So either check the implementation or comment this line in the code"));
-//					}
-			  }
-		}
+		// Boundary IDs of the ends (x) and the lower and upper face (y) of the beam
+		 numEx::BoundaryClassifier<dim> boundary_classifier ( search_tolerance );
+		 boundary_classifier.add_plane( enums::x, 0.0, enums::id_boundary_xMinus )
+							.add_plane( enums::x, state.body_dimensions[enums::x], enums::id_boundary_xPlus )
+							.add_plane( enums::y, 0.0, enums::id_boundary_yMinus )
+							.add_plane( enums::y, state.body_dimensions[enums::y], enums::id_boundary_yPlus );
+		 boundary_classifier.apply( triangulation );
 //
 //			triangulation.refine_global(parameter.nbr_global_refinements);	// ... Parameter.prm file
 //
@@ -419,7 +378,7 @@ namespace Beam
 
 // 3d grid
 	template <int dim>
-	void make_grid( Triangulation<3> &triangulation, const Parameter::GeneralParameters &parameter )
+	void make_grid( Triangulation<3> &triangulation, const Parameter::GeneralParameters &parameter, State &state=example_state )
 	{
 		parameterCollection parameters_internal;
 
@@ -433,9 +392,9 @@ namespace Beam
 		// USER PARAMETERS
 		 double refined_fraction=length/4.;
 
-		body_dimensions[enums::x] = length;
-		body_dimensions[enums::y] = width;
-		body_dimensions[enums::z] = thickness;
+		state.body_dimensions[enums::x] = length;
+		state.body_dimensions[enums::y] = width;
+		state.body_dimensions[enums::z] = thickness;
 
 		// The bar is created from two bricks, where the first will be meshed very fine
 		// and the second remains coarse. The bricks are spanned by three points.
@@ -445,7 +404,8 @@ namespace Beam
 		 Point<dim> p4 (length, width, thickness);
 
 		// Use fine and coarse brick
-		if ( parameter.refine_special==enums::Mesh_refine_special_standard )
+		if ( parameter.refine_special==enums::Mesh_refine_special_standard
+			 || parameter.refine_special==enums::Mesh_refine_beam_fineCoarseBrick_minimal )
 		{
 			// Vector containing the number of elements in each dimension
 			// The coarse segment consists of the set number of elements in the y-direction
@@ -460,26 +420,14 @@ namespace Beam
 			 repetitions_fine[enums::y] = 3; // y
 			 repetitions_fine[enums::z] = parameter.nbr_elementsInZ;
 
-			Triangulation<3> triangulation_fine, triangulation_coarse;
-			// The fine brick
-			 GridGenerator::subdivided_hyper_rectangle ( triangulation_fine,
-														 repetitions_fine,
-														 p1,
-														 p2 );
-
-			// The coarse brick
-			 GridGenerator::subdivided_hyper_rectangle ( triangulation_coarse,
-														 repetitions,
-														 p2,
-														 p3 );
-
-			// Merging fine and coarse brick
+			// Create and merge the fine brick (p1->p2) and the coarse brick (p2->p3)
 			// @note The interface between the two bricks needs to be meshed identically.
 			// deal.II cannot detect hanging nodes there.
-			GridGenerator::merge_triangulations( triangulation_fine,
-												 triangulation_coarse,
-												 triangulation,
-												 1e-9 * length );
+			 numEx::create_merged_bricks<dim>( triangulation,
+											   { {p1,p2}, {p2,p3} },
+											   { repetitions_fine, repetitions },
+											   1e-9 * length,
+											   parameter.refine_special == enums::Mesh_refine_beam_fineCoarseBrick_minimal );
 
 			// Local refinement
 			if ( parameter.nbr_holeEdge_refinements >= 0 && parameter.nbr_global_refinements==0 )
@@ -524,60 +472,17 @@ namespace Beam
 														 p4 );
 		}
 
-		// Clear boundary ID's
-		for (typename Triangulation<dim>::active_cell_iterator
-			 cell = triangulation.begin_active();
-			 cell != triangulation.end(); ++cell)
-		{
-			for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-			  if (cell->face(face)->at_boundary())
-			  {
-				  cell->face(face)->set_all_boundary_ids(0);
-			  }
-		}
-
-		// Set boundary IDs and and manifolds
-		const Point<dim> direction (0,0,1);
-		const Point<dim> centre (0,0,0);
-		for (typename Triangulation<dim>::active_cell_iterator
-			 cell = triangulation.begin_active();
-			 cell != triangulation.end(); ++cell)
-		{
-			for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-			  if (cell->face(face)->at_boundary())
-			  {
-				// Set boundary IDs
-				if (std::abs(cell->face(face)->center()[0] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_xMinus);
-				}
-				else if ( std::abs(cell->face(face)->center()[enums::x] - body_dimensions[enums::x] ) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_xPlus);
-				}
-				else if (std::abs(cell->face(face)->center()[1] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yMinus);
-				}
-				else if (std::abs(cell->face(face)->center()[enums::y] - body_dimensions[enums::y]) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yPlus);
-				}
-				else if (std::abs(cell->face(face)->center()[2] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_zMinus);
-				}
-				else if (std::abs(cell->face(face)->center()[enums::z] - body_dimensions[enums::z]) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_zPlus);
-				}
-				else
-				{
-					// There are just eight faces, so if we missed one, something went clearly terribly wrong
-					 AssertThrow(false, ExcMessage("Beam - make_grid 3D<< Found an unidentified face at the boundary. Maybe it slipt through the assignment or that face is simply not needed. So either check the implementation or comment this line in the code"));
-				}
-			  }
-		}
+		// Boundary IDs of the six sides of the beam
+		 numEx::BoundaryClassifier<dim> boundary_classifier ( search_tolerance );
+		 boundary_classifier.add_plane( enums::x, 0.0, enums::id_boundary_xMinus )
+							.add_plane( enums::x, state.body_dimensions[enums::x], enums::id_boundary_xPlus )
+							.add_plane( enums::y, 0.0, enums::id_boundary_yMinus )
+							.add_plane( enums::y, state.body_dimensions[enums::y], enums::id_boundary_yPlus )
+							.add_plane( enums::z, 0.0, enums::id_boundary_zMinus )
+							.add_plane( enums::z, state.body_dimensions[enums::z], enums::id_boundary_zPlus );
+		 const unsigned int n_unidentified_faces = boundary_classifier.apply( triangulation );
+		// There are just six sides, so if we missed a face, something went clearly terribly wrong
+		 AssertThrow( n_unidentified_faces==0, ExcMessage("Beam - make_grid 3D<< Found an unidentified face at the boundary. Maybe it slipt through the assignment or that face is simply not needed. So either check the implementation or comment this line in the code"));
 
 		triangulation.refine_global(parameter.nbr_global_refinements);	// ... Parameter.prm file
 
@@ -25,15 +25,22 @@ namespace Butterfly_shear
 	 const unsigned int loading_direction = enums::y;
 //	 const unsigned int loading_direction = enums::x;
 
-	// Evaluation point
-	 Point<3> eval_point;
-
 	// The loaded faces:
 	 const enums::enum_boundary_ids id_boundary_load = enums::id_boundary_xPlus;
 	 const enums::enum_boundary_ids id_boundary_secondaryLoad = enums::id_boundary_none;
 
-	// Characteristic body dimensions
-	 std::vector<double> body_dimensions (5);
+	 struct State
+	 {
+		// Evaluation point
+		 Point<3> eval_point;
+
+		// Characteristic body dimensions
+		 std::vector<double> body_dimensions = std::vector<double>(5);
+	 };
+	 State example_state;
+
+	 Point<3> &eval_point = example_state.eval_point;
+	 std::vector<double> &body_dimensions = example_state.body_dimensions;
 
 	// Some internal parameters
 	 struct parameterCollection
@@ -63,7 +70,7 @@ namespace Butterfly_shear
 
 	// 2D grid
 	template <int dim>
-	void make_grid( Triangulation<2> &triangulation, const Parameter::GeneralParameters &parameter )
+	void make_grid( Triangulation<2> &triangulation, const Parameter::GeneralParameters &parameter, State &state=example_state )
 	{
 		// ToDo-assure: the use the values from the parameter file
 		// _b: body of butterfly
@@ -77,19 +84,19 @@ namespace Butterfly_shear
 		const double aux_ratio = (height_w-height_b)/(2.*width_w);
 		const double notch_radius = width_b/2. / (aux_ratio/std::sqrt(1+aux_ratio*aux_ratio));
 
-		body_dimensions[enums::x] = 2.*width_w+width_b;
-		body_dimensions[enums::y] = height_w;
+		state.body_dimensions[enums::x] = 2.*width_w+width_b;
+		state.body_dimensions[enums::y] = height_w;
 
 		// Set the evaluation point
 		if ( loading_direction == enums::y )
 		{
-			 eval_point[enums::x] = body_dimensions[enums::x];
-			 eval_point[enums::y] = body_dimensions[enums::y];
+			 state.eval_point[enums::x] = state.body_dimensions[enums::x];
+			 state.eval_point[enums::y] = state.body_dimensions[enums::y];
 		}
 		else if ( loading_direction == enums::x )
 		{
-			 eval_point[enums::x] = body_dimensions[enums::x];
-			 eval_point[enums::y] = body_dimensions[enums::y]/2.;
+			 state.eval_point[enums::x] = state.body_dimensions[enums::x];
+			 state.eval_point[enums::y] = state.body_dimensions[enums::y]/2.;
 		}
 
 		parameterCollection parameters_internal;
@@ -144,24 +151,11 @@ namespace Butterfly_shear
 		// Merge the wings and the body
 		 GridGenerator::merge_triangulations( {&tria_leftWing, &tria_body, &tria_rightWing}, triangulation, 1e-6 );
 
-		// Clear all existing boundary ID's
-		 numEx::clear_boundary_IDs( triangulation );
-
-		// Set boundary IDs and and manifolds
-		 for (typename Triangulation<dim>::active_cell_iterator
-			 cell = triangulation.begin_active();
-			 cell != triangulation.end(); ++cell)
-		 {
-			for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-			  if (cell->face(face)->at_boundary())
-			  {
-				//Set boundary IDs
-				if (std::abs(cell->face(face)->center()[0] - 0.0) < search_tolerance )
-					cell->face(face)->set_boundary_id(enums::id_boundary_xMinus);
-				else if (std::abs(cell->face(face)->center()[0] - body_dimensions[enums::x]) < search_tolerance)
-					cell->face(face)->set_boundary_id(enums::id_boundary_xPlus);
-			  }
-		 }
+		// Boundary IDs of the clamped ends of both wings
+		 numEx::BoundaryClassifier<dim> boundary_classifier ( search_tolerance );
+		 boundary_classifier.add_plane( enums::x, 0.0, enums::id_boundary_xMinus )
+							.add_plane( enums::x, state.body_dimensions[enums::x], enums::id_boundary_xPlus );
+		 boundary_classifier.apply( triangulation );
 
 		// Attach the notch radius manifolds
 		 if ( true )
@@ -174,24 +168,24 @@ namespace Butterfly_shear
 				  if (cell->face(face)->at_boundary())
 				  {
 					// Look for the faces at the top and bottom of the butterfly body cell
-					 if ( std::abs(cell->face(face)->center()[0] - body_dimensions[enums::x]/2.) < search_tolerance )
+					 if ( std::abs(cell->face(face)->center()[0] - state.body_dimensions[enums::x]/2.) < search_tolerance )
 					 {
 						// Upper radius
-						 if ( cell->face(face)->center()[enums::y] > body_dimensions[enums::y]/2. )
+						 if ( cell->face(face)->center()[enums::y] > state.body_dimensions[enums::y]/2. )
 							cell->face(face)->set_all_manifold_ids(parameters_internal.manifold_id_upper_radius);
 						// Lower radius
-						 else if ( cell->face(face)->center()[enums::y] < body_dimensions[enums::y]/2. )
+						 else if ( cell->face(face)->center()[enums::y] < state.body_dimensions[enums::y]/2. )
 							cell->face(face)->set_all_manifold_ids(parameters_internal.manifold_id_lower_radius);
 					 }
 				  }
 			}
 			// For the upper radius
-			 Point<dim> centre_upper_radius (body_dimensions[enums::x]/2., (height_w-height_b)/2. + height_b + width_b/2. / aux_ratio);
+			 Point<dim> centre_upper_radius (state.body_dimensions[enums::x]/2., (height_w-height_b)/2. + height_b + width_b/2. / aux_ratio);
 			 static SphericalManifold<dim> spherical_manifold_upper (centre_upper_radius);
 			 triangulation.set_manifold(parameters_internal.manifold_id_upper_radius,spherical_manifold_upper);
 
 			// For the lower radius
-			 Point<dim> centre_lower_radius (body_dimensions[enums::x]/2., (height_w-height_b)/2. - width_b/2. / aux_ratio );
+			 Point<dim> centre_lower_radius (state.body_dimensions[enums::x]/2., (height_w-height_b)/2. - width_b/2. / aux_ratio );
 			 static SphericalManifold<dim> spherical_manifold_lower (centre_lower_radius);
 			 triangulation.set_manifold(parameters_internal.manifold_id_lower_radius,spherical_manifold_lower);
 		 }
@@ -227,9 +221,19 @@ namespace Butterfly_shear
 	}
 
 
+	/**
+	 * Higher order mapping that follows both notch radii of the butterfly body (2D) with precomputed support points
+	 */
+	template<int dim>
+	const Mapping<dim> &get_mapping ( const Triangulation<dim> &triangulation, const unsigned int mapping_degree=2 )
+	{
+		return numEx::get_manifold_mapping( triangulation, mapping_degree );
+	}
+
+
 	// 3d grid
 	template <int dim>
-	void make_grid( Triangulation<3> &triangulation, const Parameter::GeneralParameters &parameter )
+	void make_grid( Triangulation<3> &triangulation, const Parameter::GeneralParameters &parameter, State &state=example_state )
 	{
 		parameterCollection parameters_internal;
 
@@ -244,6 +248,8 @@ namespace Butterfly_shear
 		 const unsigned int nbr_coarse_in_fine_section = 2;
 		const double refined_fraction = double(nbr_coarse_in_fine_section)/parameter.grid_y_repetitions;
 		const bool use_fine_and_coarse_brick = true;
+		// Build the fine and coarse brick from a minimal coarse mesh plus global refinements (deep level hierarchy for multigrid)
+		 const bool use_minimal_coarse_mesh = ( parameter.refine_special==enums::Mesh_Butterfly_coarse_and_fine_brick_minimal );
 		const bool hardcoded_repetitions = false;
 
 		// ToDo: use the values from the parameter file
@@ -254,9 +260,9 @@ namespace Butterfly_shear
 		// The notch length is set (for consistency) s.t. its mesh discretisation is exact for 1 local refinement (start)
 		 double notch_length = length/10.;//(2.*parameter.grid_y_repetitions);
 
-		body_dimensions[enums::x] = width;
-		body_dimensions[enums::y] = length;
-		body_dimensions[enums::z] = thickness;
+		state.body_dimensions[enums::x] = width;
+		state.body_dimensions[enums::y] = length;
+		state.body_dimensions[enums::z] = thickness;
 
 		// The bar is created from two bricks, where the first will be meshed very fine
 		// and the second remains coarse. The bricks are spanned by three points.
@@ -280,26 +286,14 @@ namespace Butterfly_shear
 			 repetitions_fine[enums::y] = (parameter.grid_y_repetitions * refined_fraction) * std::pow(2.,parameter.nbr_holeEdge_refinements) * (parameter.nbr_global_refinements+1); // y
 			 repetitions_fine[enums::z] = parameter.nbr_elementsInZ;
 
-			Triangulation<3> triangulation_fine, triangulation_coarse;
-			// The fine brick
-			 GridGenerator::subdivided_hyper_rectangle ( triangulation_fine,
-														 repetitions_fine,
-														 p1,
-														 p2 );
-
-			// The coarse brick
-			 GridGenerator::subdivided_hyper_rectangle ( triangulation_coarse,
-														 repetitions,
-														 p2,
-														 p3 );
-
-			// Merging fine and coarse brick
+			// Create and merge the fine brick (p1->p2) and the coarse brick (p2->p3)
 			// @note The interface between the two bricks needs to be meshed identically.
 			// deal.II cannot detect hanging nodes there.
-			GridGenerator::merge_triangulations( triangulation_fine,
-												 triangulation_coarse,
-												 triangulation,
-												 1e-9 * length );
+			 numEx::create_merged_bricks<dim>( triangulation,
+											   { {p1,p2}, {p2,p3} },
+											   { repetitions_fine, repetitions },
+											   1e-9 * length,
+											   use_minimal_coarse_mesh );
 
 			// Local refinement
 			if ( parameter.nbr_holeEdge_refinements >= 0 && parameter.nbr_global_refinements==0 )
@@ -343,60 +337,17 @@ namespace Butterfly_shear
 			 notch_length = length/8.;
 		}
 
-		// Clear boundary ID's
-		for (typename Triangulation<dim>::active_cell_iterator
-			 cell = triangulation.begin_active();
-			 cell != triangulation.end(); ++cell)
-		{
-			for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-			  if (cell->face(face)->at_boundary())
-			  {
-				  cell->face(face)->set_all_boundary_ids(0);
-			  }
-		}
-
-		// Set boundary IDs and and manifolds
-		const Point<dim> direction (0,0,1);
-		const Point<dim> centre (0,0,0);
-		for (typename Triangulation<dim>::active_cell_iterator
-			 cell = triangulation.begin_active();
-			 cell != triangulation.end(); ++cell)
-		{
-			for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-			  if (cell->face(face)->at_boundary())
-			  {
-				// Set boundary IDs
-				if (std::abs(cell->face(face)->center()[0] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_xMinus);
-				}
-				else if ( std::abs(cell->face(face)->center()[enums::x] - body_dimensions[enums::x] ) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_xPlus);
-				}
-				else if (std::abs(cell->face(face)->center()[1] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yMinus);
-				}
-				else if (std::abs(cell->face(face)->center()[1] - length) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yPlus);
-				}
-				else if (std::abs(cell->face(face)->center()[2] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_zMinus);
-				}
-				else if (std::abs(cell->face(face)->center()[2] - thickness) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_zPlus);
-				}
-				else
-				{
-					// There are just eight faces, so if we missed one, something went clearly terribly wrong
-					 AssertThrow(false, ExcMessage("BarModel - make_grid 3D<< Found an unidentified face at the boundary. Maybe it slipt through the assignment or that face is simply not needed. So either check the implementation or comment this line in the code"));
-				}
-			  }
-		}
+		// Boundary IDs of the six sides of the bar
+		 numEx::BoundaryClassifier<dim> boundary_classifier ( search_tolerance );
+		 boundary_classifier.add_plane( enums::x, 0.0, enums::id_boundary_xMinus )
+							.add_plane( enums::x, state.body_dimensions[enums::x], enums::id_boundary_xPlus )
+							.add_plane( enums::y, 0.0, enums::id_boundary_yMinus )
+							.add_plane( enums::y, length, enums::id_boundary_yPlus )
+							.add_plane( enums::z, 0.0, enums::id_boundary_zMinus )
+							.add_plane( enums::z, thickness, enums::id_boundary_zPlus );
+		 const unsigned int n_unidentified_faces = boundary_classifier.apply( triangulation );
+		// There are just six sides, so if we missed a face, something went clearly terribly wrong
+		 AssertThrow( n_unidentified_faces==0, ExcMessage("BarModel - make_grid 3D<< Found an unidentified face at the boundary. Maybe it slipt through the assignment or that face is simply not needed. So either check the implementation or comment this line in the code"));
 
 //		if ( refinement_only_globally )
 //			triangulation.refine_global(parameter.nbr_global_refinements);	// ... Parameter.prm file
@@ -455,7 +406,7 @@ namespace Butterfly_shear
 			 Point<3> notching; // initially zero
 			// Depending on the desired notching direction (notched_face),
 			// we set the according shift component to the overall reduction
-			 notching[notched_face] = - body_dimensions[notched_face] * ( 1.-notch_reduction );
+			 notching[notched_face] = - state.body_dimensions[notched_face] * ( 1.-notch_reduction );
 
 			// A quick assurance variable to assure that at least a single vertex has been found,
 			// so our search criterion where to look for the vertices is not completely off
@@ -468,7 +419,7 @@ namespace Butterfly_shear
 				for (unsigned int vertex=0; vertex < GeometryInfo<dim>::vertices_per_cell; ++vertex)
 				 // Find vertices that are in the first 1/16 of the entire length
 				  if ( std::abs(cell->vertex(vertex)[loading_direction]) <  notch_length )
-					  if ( std::abs( cell->vertex(vertex)[notched_face] - body_dimensions[notched_face]) < search_tolerance )
+					  if ( std::abs( cell->vertex(vertex)[notched_face] - state.body_dimensions[notched_face]) < search_tolerance )
 					  {
 						  // The found vertex is moved by the \a notching vector
 						  // The notching shall be linear, hence a vertex in the notch is fully notched and the farther you
@@ -46,17 +46,6 @@ namespace HyperCube
 	 const enums::enum_boundary_ids id_boundary_load = enums::id_boundary_yPlus;
 	 const enums::enum_boundary_ids id_boundary_secondaryLoad = enums::id_boundary_xPlus;
 
-	// Characteristic body dimensions
-	 std::vector<double> body_dimensions (5);
-	 
-	// Evaluation point
-	// @note We cannot init the point yet, because we don't have the geometry dimensions and geometry
-	 Point<3> eval_point;
-	 
-	// Evaluation path
-	 Point<3> eval_path_start;
-	 Point<3> eval_path_end;
-
 	// Some internal parameters
 	 struct parameterCollection
 	 {
@@ -86,11 +75,58 @@ namespace HyperCube
 //	  std::shared_ptr<HalfWallRigid<2>> rigid_wall = std::shared_ptr<HalfWallRigid<2>>(new HalfWallRigid<2>( {wall_point_on_plane,wall_normal_unit_vector,wall_normal_unit_vector} , {-1} ));
 
 	 // Sphere
+	 // @todo The contact bodies of the contact library are 2D only, so the contact of this example only works in 2D
 	  Point<2> punch_center = Point<2>(0.0,2.0);
 	  const Point<2> punch_loading_vector = Point<2>(0.,-1.);
-	  std::shared_ptr<SphereRigid<2>> rigid_wall = std::shared_ptr<SphereRigid<2>>(new SphereRigid<2>( {punch_center,punch_loading_vector,punch_loading_vector}, {1.0,0,0} ));
+	  inline std::shared_ptr<SphereRigid<2>> create_rigid_wall ()
+	  {
+		return std::shared_ptr<SphereRigid<2>>(new SphereRigid<2>( {punch_center,punch_loading_vector,punch_loading_vector}, {1.0,0,0} ));
+	  }
+
+	 struct State
+	 {
+		// Characteristic body dimensions
+		 std::vector<double> body_dimensions = std::vector<double>(5);
+
+		// Evaluation point
+		// @note We cannot init the point yet, because we don't have the geometry dimensions and geometry
+		 Point<3> eval_point;
+
+		// Evaluation path
+		 Point<3> eval_path_start;
+		 Point<3> eval_path_end;
+
+		// Contact body (moved in make_constraints)
+		 std::shared_ptr<SphereRigid<2>> rigid_wall = create_rigid_wall();
+	 };
+	 State example_state;
+
+	 std::vector<double> &body_dimensions = example_state.body_dimensions;
+	 Point<3> &eval_point = example_state.eval_point;
+	 Point<3> &eval_path_start = example_state.eval_path_start;
+	 Point<3> &eval_path_end = example_state.eval_path_end;
+	 std::shared_ptr<SphereRigid<2>> &rigid_wall = example_state.rigid_wall;
 
 	  
+	/**
+	 * The load of the homogeneous material point (see numEx::MaterialPointDriver), equivalent to the single element without refinements:
+	 * Uniaxial load in the \a loading_direction, the symmetry constraints suppress all shear components and the lateral faces are stress-free.
+	 * @param current_load_increment Displacement increment of the loaded face
+	 */
+	template<int dim>
+	numEx::MaterialPointLoad<dim> make_material_point_load ( const double &current_load_increment, const Parameter::GeneralParameters &parameter )
+	{
+		AssertThrow( parameter.driver == enums::Dirichlet, ExcMessage(numEx_name+"<< The material point can only be driven by Dirichlet loads."));
+
+		numEx::MaterialPointLoad<dim> load;
+		for ( unsigned int i=0; i<dim; i++ )
+			for ( unsigned int j=0; j<dim; j++ )
+				if ( i!=j )
+					load.prescribe( i, j, 0 );
+		load.prescribe( loading_direction, loading_direction, current_load_increment/parameter.width );
+		return load;
+	}
+
 	/**
 	 * Apply the boundary conditions (support and load) on the given AffineConstraints \a constraints. \n
 	 * For the HyperCube that are three symmetry constraints on each plane (x=0, y=0, z=0) and the load on the \a id_boundary_load (for Dirichlet).
@@ -99,7 +135,7 @@ namespace HyperCube
 	 */
 	template<int dim>
 	void make_constraints ( AffineConstraints<double> &constraints, const FESystem<dim> &fe, DoFHandler<dim> &dof_handler_ref,
-							const bool &apply_dirichlet_bc, double &current_load_increment, const Parameter::GeneralParameters &parameter )
+							const bool &apply_dirichlet_bc, double &current_load_increment, const Parameter::GeneralParameters &parameter, State &state=example_state )
 	{
 		// BC on x0 plane
 		 numEx::BC_apply( enums::id_boundary_xMinus, enums::x, 0, apply_dirichlet_bc, dof_handler_ref, fe, constraints );
@@ -123,79 +159,49 @@ namespace HyperCube
 		 else if ( parameter.driver == enums::Contact ) // ... as contact
 		 {
 			if (apply_dirichlet_bc == true )
-				rigid_wall->move( current_load_increment );
+				state.rigid_wall->move( current_load_increment );
 	 	 }
 	}
 
 	// HyperCube grid: 2D and 3D
 	template<int dim>
-	void make_grid ( Triangulation<dim> &triangulation, const Parameter::GeneralParameters &parameter )
+	void make_grid ( Triangulation<dim> &triangulation, const Parameter::GeneralParameters &parameter, State &state=example_state )
 	{
 		const double search_tolerance = parameterCollection::search_tolerance;
 
 		const double width = parameter.width;
 		
 		// Assign the characteristic dimensions of the cube
-		 body_dimensions[enums::x] = width;
-		 body_dimensions[enums::y] = width;
-		 body_dimensions[enums::z] = width;
+		 state.body_dimensions[enums::x] = width;
+		 state.body_dimensions[enums::y] = width;
+		 state.body_dimensions[enums::z] = width;
 		
 		// Set the evaluation point
-		 eval_point[enums::x] = 0;
-		 eval_point[enums::y] = width;
-		 eval_point[enums::z] = 0;
+		 state.eval_point[enums::x] = 0;
+		 state.eval_point[enums::y] = width;
+		 state.eval_point[enums::z] = 0;
 
 		// Set the evaluation path points
-		 eval_path_start = Point<3> (0,0,0);
-		 eval_path_start = eval_point;
+		 state.eval_path_start = Point<3> (0,0,0);
+		 state.eval_path_start = state.eval_point;
 
 		// Create the triangulation
 		 GridGenerator::hyper_cube(triangulation,0,width);
 
-		// Clear all existing boundary ID's
-		 numEx::clear_boundary_IDs( triangulation );
-		 
-		// Set the boundary IDs
-		 for ( typename Triangulation<dim>::active_cell_iterator
-			  cell = triangulation.begin_active();
-			  cell != triangulation.end(); ++cell )
-		 {
-			for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-			  if (cell->face(face)->at_boundary())
-			  {
-				if (std::abs(cell->face(face)->center()[enums::x] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_xMinus);
-				}
-				else if (std::abs(cell->face(face)->center()[enums::x] - body_dimensions[enums::x]) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_xPlus);
-				}
-				else if (std::abs(cell->face(face)->center()[enums::y] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yMinus);
-				}
-				else if (std::abs(cell->face(face)->center()[enums::y] - body_dimensions[enums::y]) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yPlus);
-				}
-				else if (dim==3 && std::abs(cell->face(face)->center()[enums::z] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_zMinus);
-				}
-				else if (dim==3 && std::abs(cell->face(face)->center()[enums::z] - body_dimensions[enums::z]) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_zPlus);
-				}
-				else
-				{
-					// There are only 6 faces for a cube in 3D, so if we missed one, something went terribly wrong
-					AssertThrow(false, ExcMessage( numEx_name+" - make_grid 3D<< Found an unidentified face at the boundary. "
-												   "Maybe it slipt through the assignment or that face is simply not needed. "
-												   "So either check the implementation or comment this line in the code") );
-				}
-			  }
-		 }
+		// Boundary IDs of the faces of the cube
+		 numEx::BoundaryClassifier<dim> boundary_classifier ( search_tolerance );
+		 boundary_classifier.add_plane( enums::x, 0.0, enums::id_boundary_xMinus )
+							.add_plane( enums::x, state.body_dimensions[enums::x], enums::id_boundary_xPlus )
+							.add_plane( enums::y, 0.0, enums::id_boundary_yMinus )
+							.add_plane( enums::y, state.body_dimensions[enums::y], enums::id_boundary_yPlus );
+		 if ( dim==3 )
+			 boundary_classifier.add_plane( enums::z, 0.0, enums::id_boundary_zMinus )
+								.add_plane( enums::z, state.body_dimensions[enums::z], enums::id_boundary_zPlus );
+		 const unsigned int n_unidentified_faces = boundary_classifier.apply( triangulation );
+		// There are only 6 faces for a cube in 3D, so if we missed one, something went terribly wrong
+		 AssertThrow( n_unidentified_faces==0, ExcMessage( numEx_name+" - make_grid 3D<< Found an unidentified face at the boundary. "
+														   "Maybe it slipt through the assignment or that face is simply not needed. "
+														   "So either check the implementation or comment this line in the code") );
 
 		// Refinement
 		 triangulation.refine_global( parameter.nbr_global_refinements );
@@ -203,25 +209,14 @@ namespace HyperCube
 		// Mark the cell at the centre \a centre by a material id of 1 ...
 		 if ( triangulation.n_active_cells()>1 ) // ... only if there is more than one cell
 		 {
-			bool found_cell=false;
 			Point<dim> centre ( 0, 0, 0 );
-			for (typename Triangulation<dim>::active_cell_iterator
-						 cell = triangulation.begin_active();
-						 cell != triangulation.end(); ++cell)
-			{
-				for (unsigned int vertex=0; vertex < GeometryInfo<dim>::vertices_per_cell; ++vertex)
-				  if ( (cell->vertex(vertex)).distance(centre)<1e-12 )
-				  {
-					  cell->set_material_id(1);
-					  found_cell = true;
-					  break;
-				  }
-
-				if ( found_cell )
-					break; // break out of the entire for(cell) loop
-			} // end for(cell)
+			numEx::VertexIndex<dim> vertex_index ( triangulation );
+			const unsigned int index_centre = vertex_index.find_vertex( centre, 1e-12 );
+			const bool found_cell = ( index_centre != numbers::invalid_unsigned_int );
 
 			AssertThrow(found_cell, ExcMessage(numEx_name+"<< Was not able to identify the cell at the origin(0,0,0). Please recheck the triangulation or adapt the code."));
+
+			vertex_index.cell(index_centre)->set_material_id(1);
 		 }
 
 		// Distortion
@@ -356,19 +351,10 @@ namespace HyperCube
 			} // end if(dim==3)
 			else if ( dim==2 )
 			{
-				for (typename Triangulation<dim>::active_cell_iterator
-							 cell = triangulation.begin_active();
-							 cell != triangulation.end(); ++cell)
-				{
-					//cell->vertex(3)[enums::y] -= 0.15;
-					Point<dim> corner_rightBottom (width,0);
-					for (unsigned int vertex=0; vertex < GeometryInfo<dim>::vertices_per_cell; ++vertex)
-					  if ( (cell->vertex(vertex)).distance(corner_rightBottom)<1e-12 )
-					  {
-						  cell->vertex(vertex)[enums::x] += 0.5;
-						  break;
-					  }
-				}
+				//cell->vertex(3)[enums::y] -= 0.15;
+				Point<dim> corner_rightBottom (width,0);
+				Point<dim> shift_of_corner_rightBottom (0.5,0);
+				numEx::shift_vertex_by_vector( triangulation, {corner_rightBottom}, {shift_of_corner_rightBottom}, numEx_name );
 			} // end if(dim==2)
 		} // end if(element_distortion)
 		
@@ -390,13 +376,14 @@ namespace HyperCube
 			std::vector< std::shared_ptr< PointHistory<dim> > > lqph,
 			const std::vector<types::global_dof_index> local_dof_indices,
 			FullMatrix<double> &cell_matrix,
-			Vector<double> &cell_rhs
+			Vector<double> &cell_rhs,
+			State &state=example_state
 	)
 	{
 		// Assemble the contact pair
 		assemble_contact(
 							cell,
-							rigid_wall,
+							state.rigid_wall,
 							{enums::id_boundary_yPlus},
 							penalty_stiffness,
 							fe,
@@ -47,17 +47,6 @@ namespace HyperCube_shear
 	 const enums::enum_boundary_ids id_boundary_load = enums::id_boundary_yPlus;
 	 const enums::enum_boundary_ids id_boundary_secondaryLoad = enums::id_boundary_xPlus;
 
-	// Characteristic body dimensions
-	 std::vector<double> body_dimensions (5);
-	 
-	// Evaluation point
-	// @note We cannot init the point yet, because we don't have the geometry dimensions and geometry
-	 Point<3> eval_point;
-	 
-	// Evaluation path
-	 Point<3> eval_path_start;
-	 Point<3> eval_path_end;
-
 	// Some internal parameters
 	 struct parameterCollection
 	 {
@@ -67,10 +56,6 @@ namespace HyperCube_shear
 		static constexpr double search_tolerance = 1e-12;
 	 };
 	 
-	// Evaluation points: \n
-	// @todo We need \a dim here instead of 2, but dim is unkown at this place -> redesign
-	 std::vector< numEx::EvalPointClass<3> > eval_points_list (2, numEx::EvalPointClass<3>() );
-
 
 	// All additional parameters
 	// @todo Group them somehow
@@ -94,9 +79,111 @@ namespace HyperCube_shear
 	 // Sphere
 	  Point<2> punch_center = Point<2>(0.0,3.0);
 	  const Point<2> punch_loading_vector = Point<2>(0.,-1.);
-	  std::shared_ptr<SphereRigid<2>> rigid_wall = std::shared_ptr<SphereRigid<2>>(new SphereRigid<2>( {punch_center,punch_loading_vector,punch_loading_vector}, {1.0,0,0} ));
+	  inline std::shared_ptr<SphereRigid<2>> create_rigid_wall ()
+	  {
+		return std::shared_ptr<SphereRigid<2>>(new SphereRigid<2>( {punch_center,punch_loading_vector,punch_loading_vector}, {1.0,0,0} ));
+	  }
+
+	 struct State
+	 {
+		// Characteristic body dimensions
+		 std::vector<double> body_dimensions = std::vector<double>(5);
+
+		// Evaluation point
+		// @note We cannot init the point yet, because we don't have the geometry dimensions and geometry
+		 Point<3> eval_point;
+
+		// Evaluation path
+		 Point<3> eval_path_start;
+		 Point<3> eval_path_end;
+
+		// Evaluation points: \n
+		// @todo We need \a dim here instead of 2, but dim is unkown at this place -> redesign
+		 std::vector< numEx::EvalPointClass<3> > eval_points_list = std::vector< numEx::EvalPointClass<3> >(2, numEx::EvalPointClass<3>());
+
+		// Contact body (moved in make_constraints)
+		 std::shared_ptr<SphereRigid<2>> rigid_wall = create_rigid_wall();
+
+		// Load path of the fixed load steps, built in the first call of make_constraints
+		 numEx::LoadPath load_path;
+	 };
+	 State example_state;
+
+	 std::vector<double> &body_dimensions = example_state.body_dimensions;
+	 Point<3> &eval_point = example_state.eval_point;
+	 Point<3> &eval_path_start = example_state.eval_path_start;
+	 Point<3> &eval_path_end = example_state.eval_path_end;
+	 std::vector< numEx::EvalPointClass<3> > &eval_points_list = example_state.eval_points_list;
+	 std::shared_ptr<SphereRigid<2>> &rigid_wall = example_state.rigid_wall;
 
 	  
+	/**
+	 * The load path: the shear angle as function of the pseudo-time t, increasing by AL_initial_increment per unit of time.
+	 * The fixed load steps (make_constraints) use the load step as pseudo-time and continue the ramp beyond the \a duration (see numEx::LoadPath),
+	 * so they do not depend on nbr_loadsteps. An adaptive load stepping (numEx::LoadStepScheduler) runs up to the \a duration.
+	 */
+	inline numEx::LoadPath get_load_path ( const Parameter::GeneralParameters &parameter, const double duration=1. )
+	{
+		numEx::LoadPath load_path;
+		// symmetric shear
+		 load_path.add_ramp( duration, parameter.AL_initial_increment );
+		// Combined tension/compression - shear (see make_constraints), the first stage is the displacement of the top face
+		 //load_path.add_ramp( duration, tension_rate ).add_ramp( duration, parameter.AL_initial_increment );
+		// cyclic shear
+		 //load_path.add_cycles( n_cycles, max_shear_angle, period );
+		return load_path;
+	}
+
+	/**
+	 * Increment of the displacement gradient H = F - I in the load step (time_last,time] of the \a load_path.
+	 * Symmetric shear [Heiduschke], originally defined by the displacements of the corners of the single element:
+	 * vertex 1 (width,0): Delta_u2 in x, vertex 2 (0,height): Delta_u4 in x and Delta_u5 in y, vertex 3 (width,height): Delta_u2+Delta_u4 in x and Delta_u5 in y
+	 */
+	template<int dim>
+	Tensor<2,dim> get_displacement_gradient_increment ( const numEx::LoadPath &load_path, const double time_last, const double time )
+	{
+		const double load = load_path.value(time);
+		const double load_last = load - load_path.increment(time_last,time);
+
+		Tensor<2,dim> Delta_H;
+		// symmetric shear
+		 Delta_H[enums::x][enums::x] = 1./std::sqrt(std::cos(load)) - 1./std::sqrt(std::cos(load_last)); // Delta_u2 / width
+		 Delta_H[enums::x][enums::y] = std::sin(load)/std::sqrt(std::cos(load)) - std::sin(load_last)/std::sqrt(std::cos(load_last)); // Delta_u4 / height
+		 Delta_H[enums::y][enums::y] = std::sqrt(std::cos(load)) - std::sqrt(std::cos(load_last)); // Delta_u5 / height
+		// simple shear
+		 //Delta_H[enums::x][enums::x] = 0;
+		 //Delta_H[enums::y][enums::y] = 0;
+		return Delta_H;
+	}
+
+	/**
+	 * The load step (time_last,time] of the homogeneous material point (see numEx::MaterialPointDriver).
+	 * All components of the displacement gradient are prescribed, so this gives exactly the response of the element(s).
+	 */
+	template<int dim>
+	numEx::MaterialPointLoad<dim> make_material_point_load ( const numEx::LoadPath &load_path, const double time_last, const double time )
+	{
+		const Tensor<2,dim> Delta_H = get_displacement_gradient_increment<dim>( load_path, time_last, time );
+
+		numEx::MaterialPointLoad<dim> load;
+		for ( unsigned int i=0; i<dim; i++ )
+			for ( unsigned int j=0; j<dim; j++ )
+				load.prescribe( i, j, Delta_H[i][j] );
+		return load;
+	}
+
+	/**
+	 * Apply the Dirichlet load of the load step (time_last,time] of the \a load_path, e.g. for an adaptive load stepping.
+	 * The homogeneous deformation is prescribed on all boundary vertices, so the test also works for refined and distorted meshes.
+	 */
+	template<int dim>
+	void apply_load ( AffineConstraints<double> &constraints, const DoFHandler<dim> &dof_handler_ref, const bool &apply_dirichlet_bc,
+					  const numEx::LoadPath &load_path, const double time_last, const double time )
+	{
+		const Tensor<2,dim> Delta_H = get_displacement_gradient_increment<dim>( load_path, time_last, time );
+		numEx::BC_apply_homogeneous_deformation( Delta_H, Tensor<1,dim>(), apply_dirichlet_bc, dof_handler_ref, constraints );
+	}
+
 	/**
 	 * Apply the boundary conditions (support and load) on the given AffineConstraints \a constraints. \n
 	 * For the HyperCube that are three symmetry constraints on each plane (x=0, y=0, z=0) and the load on the \a id_boundary_load (for Dirichlet).
@@ -106,7 +193,7 @@ namespace HyperCube_shear
 	template<int dim>
 	void make_constraints ( AffineConstraints<double> &constraints, const FESystem<dim> &fe, DoFHandler<dim> &dof_handler_ref,
 							const bool &apply_dirichlet_bc, double &current_load_increment, const Parameter::GeneralParameters &parameter,
-							const unsigned int current_load_step )
+							const unsigned int current_load_step, State &state=example_state )
 	{
 		// Fix the bottom face
 		 //numEx::BC_apply_fix( enums::id_boundary_yMinus, dof_handler_ref, fe, constraints );
@@ -117,43 +204,13 @@ namespace HyperCube_shear
 		// BC for the load ...
 		 if ( parameter.driver == enums::Dirichlet )  // ... as Dirichlet only for Dirichlet as driver, alternatively  ...
 		 {
-			 // symmetric shear [Heiduschke]
-			 const double load = current_load_step*parameter.AL_initial_increment;
-			 const double load_last = load - parameter.AL_initial_increment;
-			 const double width = 1.;
-			 const double height = 1.;
-			 const double Delta_u2 = width * ( 1./std::sqrt(std::cos(load)) - 1./std::sqrt(std::cos(load_last)) );
-			 const double Delta_u4 = width * ( std::sin(load)/std::sqrt(std::cos(load)) - std::sin(load_last)/std::sqrt(std::cos(load_last)) );
-			 const double Delta_u5 = width * ( std::sqrt(std::cos(load)) - std::sqrt(std::cos(load_last)) );
-			 const double Delta_u6 = Delta_u2 + Delta_u4;
-			 const double Delta_u7 = Delta_u5;
-
-			 // First, add lines to the constraints matrix
-			  for ( unsigned int i=0; i<8; i++)
-				 constraints.add_line(i);
-			 // Then, we fill all desired non-zero entries, here we fill every entry even the entries that are zero
-			 // symmetric shear
-			  constraints.set_inhomogeneity(0,0);
-			  constraints.set_inhomogeneity(1,0);
-			  constraints.set_inhomogeneity(2,Delta_u2);
-			  constraints.set_inhomogeneity(3,0);
-			  constraints.set_inhomogeneity(4,Delta_u4);
-			  constraints.set_inhomogeneity(5,Delta_u5);
-			  constraints.set_inhomogeneity(6,Delta_u6);
-			  constraints.set_inhomogeneity(7,Delta_u7);
-
-//			 // simple shear
-//			  constraints.set_inhomogeneity(0,0);
-//			  constraints.set_inhomogeneity(1,0);
-//			  constraints.set_inhomogeneity(2,0);
-//			  constraints.set_inhomogeneity(3,0);
-//			  constraints.set_inhomogeneity(4,Delta_u4);
-//			  constraints.set_inhomogeneity(5,0);
-//			  constraints.set_inhomogeneity(6,Delta_u4);
-//			  constraints.set_inhomogeneity(7,0);
+			 // The fixed load steps use the load step as pseudo-time of the load path, i.e. the shear angle current_load_step*AL_initial_increment
+			  if ( state.load_path.n_stages()==0 )
+				  state.load_path = get_load_path(parameter);
+			  apply_load( constraints, dof_handler_ref, apply_dirichlet_bc, state.load_path, current_load_step-1., current_load_step );
 
 			 // Combined tension/compression - shear
-//			 if ( current_load_step<=parameter.nbr_loadsteps ) // tension
+//			 if ( state.load_path.stage(current_load_step)==0 ) // tension
 //			 {
 //				 numEx::BC_apply( enums::id_boundary_xMinus, enums::x, 0, apply_dirichlet_bc, dof_handler_ref, fe, constraints );
 //				 numEx::BC_apply( enums::id_boundary_yMinus, enums::y, 0, apply_dirichlet_bc, dof_handler_ref, fe, constraints );
@@ -179,79 +236,49 @@ namespace HyperCube_shear
 		 else if ( parameter.driver == enums::Contact ) // ... as contact
 		 {
 			if (apply_dirichlet_bc == true )
-				rigid_wall->move( current_load_increment );
+				state.rigid_wall->move( current_load_increment );
 	 	 }
 	}
 
 	// HyperCube grid: 2D and 3D
 	template<int dim>
-	void make_grid ( Triangulation<dim> &triangulation, const Parameter::GeneralParameters &parameter )
+	void make_grid ( Triangulation<dim> &triangulation, const Parameter::GeneralParameters &parameter, State &state=example_state )
 	{
 		const double search_tolerance = parameterCollection::search_tolerance;
 
 		const double width = parameter.width;
 		
 		// Assign the characteristic dimensions of the cube
-		 body_dimensions[enums::x] = width;
-		 body_dimensions[enums::y] = width;
-		 body_dimensions[enums::z] = width;
+		 state.body_dimensions[enums::x] = width;
+		 state.body_dimensions[enums::y] = width;
+		 state.body_dimensions[enums::z] = width;
 		
 		// Set the evaluation point
-		 eval_point[enums::x] = 0;
-		 eval_point[enums::y] = width;
-		 eval_point[enums::z] = 0;
+		 state.eval_point[enums::x] = 0;
+		 state.eval_point[enums::y] = width;
+		 state.eval_point[enums::z] = 0;
 
 		// Set the evaluation path points
-		 eval_path_start = Point<3> (0,0,0);
-		 eval_path_start = eval_point;
+		 state.eval_path_start = Point<3> (0,0,0);
+		 state.eval_path_start = state.eval_point;
 
 		// Create the triangulation
 		 GridGenerator::hyper_cube(triangulation);
 
-		// Clear all existing boundary ID's
-		 numEx::clear_boundary_IDs( triangulation );
-		 
-		// Set the boundary IDs
-		 for ( typename Triangulation<dim>::active_cell_iterator
-			  cell = triangulation.begin_active();
-			  cell != triangulation.end(); ++cell )
-		 {
-			for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-			  if (cell->face(face)->at_boundary())
-			  {
-				if (std::abs(cell->face(face)->center()[enums::x] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_xMinus);
-				}
-				else if (std::abs(cell->face(face)->center()[enums::x] - body_dimensions[enums::x]) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_xPlus);
-				}
-				else if (std::abs(cell->face(face)->center()[enums::y] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yMinus);
-				}
-				else if (std::abs(cell->face(face)->center()[enums::y] - body_dimensions[enums::y]) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yPlus);
-				}
-				else if (dim==3 && std::abs(cell->face(face)->center()[enums::z] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_zMinus);
-				}
-				else if (dim==3 && std::abs(cell->face(face)->center()[enums::z] - body_dimensions[enums::z]) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_zPlus);
-				}
-				else
-				{
-					// There are only 6 faces for a cube in 3D, so if we missed one, something went terribly wrong
-					AssertThrow(false, ExcMessage( numEx_name+" - make_grid 3D<< Found an unidentified face at the boundary. "
-												   "Maybe it slipt through the assignment or that face is simply not needed. "
-												   "So either check the implementation or comment this line in the code") );
-				}
-			  }
-		 }
+		// Boundary IDs of the four edges of the unit square
+		 numEx::BoundaryClassifier<dim> boundary_classifier ( search_tolerance );
+		 boundary_classifier.add_plane( enums::x, 0.0, enums::id_boundary_xMinus )
+							.add_plane( enums::x, state.body_dimensions[enums::x], enums::id_boundary_xPlus )
+							.add_plane( enums::y, 0.0, enums::id_boundary_yMinus )
+							.add_plane( enums::y, state.body_dimensions[enums::y], enums::id_boundary_yPlus );
+		 if ( dim==3 )
+			 boundary_classifier.add_plane( enums::z, 0.0, enums::id_boundary_zMinus )
+								.add_plane( enums::z, state.body_dimensions[enums::z], enums::id_boundary_zPlus );
+		 const unsigned int n_unidentified_faces = boundary_classifier.apply( triangulation );
+		// There are only 6 faces for a cube in 3D, so if we missed one, something went terribly wrong
+		 AssertThrow( n_unidentified_faces==0, ExcMessage( numEx_name+" - make_grid 3D<< Found an unidentified face at the boundary. "
+														   "Maybe it slipt through the assignment or that face is simply not needed. "
+														   "So either check the implementation or comment this line in the code") );
 
 		// Refinement
 		 triangulation.refine_global( parameter.nbr_global_refinements );
@@ -259,25 +286,14 @@ namespace HyperCube_shear
 		// Mark the cell at the centre \a centre by a material id of 1 ...
 		 if ( triangulation.n_active_cells()>1 ) // ... only if there is more than one cell
 		 {
-			bool found_cell=false;
 			Point<dim> centre ( 0, 0, 0 );
-			for (typename Triangulation<dim>::active_cell_iterator
-						 cell = triangulation.begin_active();
-						 cell != triangulation.end(); ++cell)
-			{
-				for (unsigned int vertex=0; vertex < GeometryInfo<dim>::vertices_per_cell; ++vertex)
-				  if ( (cell->vertex(vertex)).distance(centre)<1e-12 )
-				  {
-					  cell->set_material_id(1);
-					  found_cell = true;
-					  break;
-				  }
-
-				if ( found_cell )
-					break; // break out of the entire for(cell) loop
-			} // end for(cell)
+			numEx::VertexIndex<dim> vertex_index ( triangulation );
+			const unsigned int index_centre = vertex_index.find_vertex( centre, 1e-12 );
+			const bool found_cell = ( index_centre != numbers::invalid_unsigned_int );
 
 			AssertThrow(found_cell, ExcMessage(numEx_name+"<< Was not able to identify the cell at the origin(0,0,0). Please recheck the triangulation or adapt the code."));
+
+			vertex_index.cell(index_centre)->set_material_id(1);
 		 }
 
 		// Distortion
@@ -412,19 +428,10 @@ namespace HyperCube_shear
 			} // end if(dim==3)
 			else if ( dim==2 )
 			{
-				for (typename Triangulation<dim>::active_cell_iterator
-							 cell = triangulation.begin_active();
-							 cell != triangulation.end(); ++cell)
-				{
-					//cell->vertex(3)[enums::y] -= 0.15;
-					Point<dim> corner_rightBottom (width,0);
-					for (unsigned int vertex=0; vertex < GeometryInfo<dim>::vertices_per_cell; ++vertex)
-					  if ( (cell->vertex(vertex)).distance(corner_rightBottom)<1e-12 )
-					  {
-						  cell->vertex(vertex)[enums::x] -= 0.1;
-						  break;
-					  }
-				}
+				//cell->vertex(3)[enums::y] -= 0.15;
+				Point<dim> corner_rightBottom (width,0);
+				Point<dim> shift_of_corner_rightBottom (-0.1,0);
+				numEx::shift_vertex_by_vector( triangulation, {corner_rightBottom}, {shift_of_corner_rightBottom}, numEx_name );
 			} // end if(dim==2)
 		} // end if(element_distortion)
 		
@@ -453,7 +460,7 @@ namespace HyperCube_shear
 		 numEx::EvalPointClass<3> eval_topLeftX ( Point<3>(0,width,0), enums::x );
 		 numEx::EvalPointClass<3> eval_topLeftY ( Point<3>(0,width,0), enums::y );
 
-		 eval_points_list = {eval_topLeftX,eval_topLeftY};
+		 state.eval_points_list = {eval_topLeftX,eval_topLeftY};
 
 		// Output the triangulation as eps or inp
 		 //numEx::output_triangulation( triangulation, enums::output_eps, numEx_name );
@@ -473,13 +480,14 @@ namespace HyperCube_shear
 			std::vector< std::shared_ptr< PointHistory<dim> > > lqph,
 			const std::vector<types::global_dof_index> local_dof_indices,
 			FullMatrix<double> &cell_matrix,
-			Vector<double> &cell_rhs
+			Vector<double> &cell_rhs,
+			State &state=example_state
 	)
 	{
 		// Assemble the contact pair
 		assemble_contact(
 							cell,
-							rigid_wall,
+							state.rigid_wall,
 							enums::id_boundary_yPlus,
 							penalty_stiffness,
 							fe,
@@ -35,9 +35,6 @@ namespace HyperRectangle
 	 const enums::enum_boundary_ids id_boundary_load = enums::id_boundary_yPlus;
 	 const enums::enum_boundary_ids id_boundary_secondaryLoad = enums::id_boundary_xPlus;
 
-	// Characteristic body dimensions
-	 std::vector<double> body_dimensions (5);
-
 	// Some internal parameters
 	 struct parameterCollection
 	 {
@@ -50,7 +47,6 @@ namespace HyperRectangle
 	// All additional parameters
 	const bool trigger_localisation_by_notching = true;
 	const enums::enum_coord notched_face = enums::x;
-	enums::enum_refine_special refine_special = enums::Mesh_refine_special_standard;
 	const bool refine_local_isotropic = true;
 	
 	// Boundary conditions
@@ -90,13 +86,27 @@ namespace HyperRectangle
 	 //const enums::enum_loading_type loading_type = enums::Brick_Seupel_etal_a;
 	 const enums::enum_loading_type loading_type = enums::compression;
 
-	// Evaluation points: \n
-	// We want points, one for the contraction of the center
-	// and one for the contraction of the top face.
-	// We don't know the coordinates yet, because the mesh has not yet been created.
-	// So we fill the data in make_grid.
-	// @todo We need \a dim here instead of 3, but dim is unkown at this place -> redesign
-	 std::vector< numEx::EvalPointClass<3> > eval_points_list (2, numEx::EvalPointClass<3>() );
+	 struct State
+	 {
+		// Characteristic body dimensions
+		 std::vector<double> body_dimensions = std::vector<double>(5);
+
+		// Special refinement (set in make_grid)
+		 enums::enum_refine_special refine_special = enums::Mesh_refine_special_standard;
+
+		// Evaluation points: \n
+		// We want points, one for the contraction of the center
+		// and one for the contraction of the top face.
+		// We don't know the coordinates yet, because the mesh has not yet been created.
+		// So we fill the data in make_grid.
+		// @todo We need \a dim here instead of 3, but dim is unkown at this place -> redesign
+		 std::vector< numEx::EvalPointClass<3> > eval_points_list = std::vector< numEx::EvalPointClass<3> >(2, numEx::EvalPointClass<3>());
+	 };
+	 State example_state;
+
+	 std::vector<double> &body_dimensions = example_state.body_dimensions;
+	 enums::enum_refine_special &refine_special = example_state.refine_special;
+	 std::vector< numEx::EvalPointClass<3> > &eval_points_list = example_state.eval_points_list;
 	 
 	/**
 	 * Apply the boundary conditions (support and load) on the given AffineConstraints \a constraints. \n
@@ -146,7 +156,8 @@ namespace HyperRectangle
 
 	void make_grid_flat( Triangulation<2> &tria_flat,
 						 const double &length, const double &width, const std::vector< numEx::NotchClass<2> > &notch_list,
-						 const unsigned int n_elements_in_x_for_coarse_mesh, const unsigned int n_refine_global, const unsigned int n_refine_local )
+						 const unsigned int n_elements_in_x_for_coarse_mesh, const unsigned int n_refine_global, const unsigned int n_refine_local,
+						 const State &state )
 	{
 		parameterCollection parameters_internal;
 		const double search_tolerance = parameters_internal.search_tolerance;
@@ -168,7 +179,8 @@ namespace HyperRectangle
 			 length_refined=length/6.;
 		 
 		// Created the base mesh from a brick, either as ...
-		 if ( refine_special==enums::Mesh_HyperRectangle_coarse_and_fine_brick /*use_fine_and_coarse_brick*/ ) // ... a fine and a coarse part or ...
+		 if ( state.refine_special==enums::Mesh_HyperRectangle_coarse_and_fine_brick /*use_fine_and_coarse_brick*/ // ... a fine and a coarse part or ...
+			  || state.refine_special==enums::Mesh_HyperRectangle_coarse_and_fine_brick_minimal )
 		 {
 			// The bricks are spanned by three points (p1,p2,p3). The bar is created from two bricks, 
 			// where the first will be meshed very fine (p1->p2) and the second remains coarse (p2->p3).
@@ -203,28 +215,14 @@ namespace HyperRectangle
 				 repetitions_fine[enums::y] = 10;
 			 }
 
-			Triangulation<2> triangulation_fine, triangulation_coarse;
-			{
-				// The fine brick
-				 GridGenerator::subdivided_hyper_rectangle ( triangulation_fine,
-															 repetitions_fine,
-															 p1,
-															 p2 );
-	
-				// The coarse brick
-				 GridGenerator::subdivided_hyper_rectangle ( triangulation_coarse,
-															 repetitions_coarse,
-															 p2,
-															 p3 );
-			}
-
-			// Merging fine and coarse brick
+			// Create and merge the fine brick (p1->p2) and the coarse brick (p2->p3)
 			// @note The interface between the two bricks needs to be meshed identically.
 			// deal.II cannot detect hanging nodes there.
-			 GridGenerator::merge_triangulations( triangulation_fine,
-												  triangulation_coarse,
-												  tria_flat,
-												  1e-9 * length /*merge tolerance at interface*/ );
+			 numEx::create_merged_bricks<2>( tria_flat,
+											 { {p1,p2}, {p2,p3} },
+											 { repetitions_fine, repetitions_coarse },
+											 1e-9 * length /*merge tolerance at interface*/,
+											 state.refine_special==enums::Mesh_HyperRectangle_coarse_and_fine_brick_minimal );
 		 }
 		 else // ... using a uniform brick with xy refinements
 		 {
@@ -249,45 +247,17 @@ namespace HyperRectangle
 														 p2 );
 		 }
 
-		// Clear all existing boundary ID's
-		 numEx::clear_boundary_IDs( tria_flat );
-
-		// Set boundary IDs
-		for (typename Triangulation<2>::active_cell_iterator
-			 cell = tria_flat.begin_active();
-			 cell != tria_flat.end(); ++cell)
-		{
-			for (unsigned int face=0; face < GeometryInfo<2>::faces_per_cell; ++face)
-			{
-			  if (cell->face(face)->at_boundary())
-			  {
-				// Set boundary IDs
-				if (std::abs(cell->face(face)->center()[enums::x] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_xMinus);
-				}
-				else if ( std::abs(cell->face(face)->center()[enums::x] - body_dimensions[enums::x] ) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_xPlus);
-				}
-				else if (std::abs(cell->face(face)->center()[enums::y] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yMinus);
-				}
-				else if (std::abs(cell->face(face)->center()[enums::y] - body_dimensions[enums::y]) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yPlus);
-				}
-				else
-				{
-					// There are only 6 faces for a cube in 3D, so if we missed one, something went terribly wrong
-					AssertThrow(false, ExcMessage( numEx_name+" - make_grid 2D<< Found an unidentified face at the boundary. "
-												   "Maybe it slipt through the assignment or that face is simply not needed. "
-												   "So either check the implementation or comment this line in the code") );
-				}
-			  }
-			}
-		} // end for(cell)
+		// Boundary IDs of the four edges of the 2D rectangle (before the extrusion)
+		 numEx::BoundaryClassifier<2> boundary_classifier ( search_tolerance );
+		 boundary_classifier.add_plane( enums::x, 0.0, enums::id_boundary_xMinus )
+							.add_plane( enums::x, state.body_dimensions[enums::x], enums::id_boundary_xPlus )
+							.add_plane( enums::y, 0.0, enums::id_boundary_yMinus )
+							.add_plane( enums::y, state.body_dimensions[enums::y], enums::id_boundary_yPlus );
+		 const unsigned int n_unidentified_faces = boundary_classifier.apply( tria_flat );
+		// There are only 4 sides of the rectangle, so if we missed a face, something went terribly wrong
+		 AssertThrow( n_unidentified_faces==0, ExcMessage( numEx_name+" - make_grid 2D<< Found an unidentified face at the boundary. "
+														   "Maybe it slipt through the assignment or that face is simply not needed. "
+														   "So either check the implementation or comment this line in the code") );
 
 		  if ( false /*pre-refine to improve notch mesh*/ )
 		  {
@@ -309,11 +279,14 @@ namespace HyperRectangle
 		 {
 			 //if ( notch_type == enums::notch_round )
 			 {
+				 // One index over the boundary vertices for all notches, it is only rebuilt if the mesh is refined in between
+				  numEx::VertexIndex<2> boundary_vertex_index ( tria_flat, /*only_boundary_vertices*/true );
+
 				 // prepare the mesh
 				  if ( notch_type == enums::notch_round )
-					 numEx::prepare_tria_for_notching( tria_flat, notch_list[0] );
+					 numEx::prepare_tria_for_notching( tria_flat, notch_list[0], boundary_vertex_index );
 
-				 numEx::notch_body( tria_flat, notch_list[0] );
+				 numEx::notch_body( tria_flat, notch_list[0], boundary_vertex_index );
 				 
 				 if ( notch_type == enums::notch_round )
 				 {
@@ -325,8 +298,8 @@ namespace HyperRectangle
 				 
 				  if ( notch_twice )
 				  {
-					 numEx::prepare_tria_for_notching( tria_flat, notch_list[1] );
-					 numEx::notch_body( tria_flat, notch_list[1] );
+					 numEx::prepare_tria_for_notching( tria_flat, notch_list[1], boundary_vertex_index );
+					 numEx::notch_body( tria_flat, notch_list[1], boundary_vertex_index );
 
 					 const Point<2> cyl_center_2D ( notch_list[1].cyl_center[0], notch_list[1].cyl_center[1] );
 
@@ -355,18 +328,18 @@ namespace HyperRectangle
 	
 	// 2D grid
 	template <int dim>
-	void make_grid( Triangulation<2> &triangulation, const Parameter::GeneralParameters &parameter )
+	void make_grid( Triangulation<2> &triangulation, const Parameter::GeneralParameters &parameter, State &state=example_state )
 	{
 		parameterCollection parameters_internal;
 		const double search_tolerance = parameters_internal.search_tolerance;
 
-		 refine_special = enums::enum_refine_special(parameter.refine_special);
+		 state.refine_special = enums::enum_refine_special(parameter.refine_special);
 
 		// Assign the dimensions of the hyper rectangle and store them as characteristic lengths
 		 const double width = parameter.width;
-		 body_dimensions[enums::x] = width;
+		 state.body_dimensions[enums::x] = width;
 		 const double length = parameter.height;
-		 body_dimensions[enums::y] = length;
+		 state.body_dimensions[enums::y] = length;
 
 		 const double notch_offset = DENP_Laura ? 10. : width;
 		 // double notch for compression or bottom notch for tension
@@ -394,27 +367,23 @@ namespace HyperRectangle
 		// Create the 2D base mesh
 		 if ( notch_twice )
 			make_grid_flat( triangulation, length, width, {notch1,notch2},
-							n_elements_in_x_for_coarse_mesh, parameter.nbr_global_refinements, parameter.nbr_holeEdge_refinements );
+							n_elements_in_x_for_coarse_mesh, parameter.nbr_global_refinements, parameter.nbr_holeEdge_refinements, state );
 		 else
 			make_grid_flat( triangulation, length, width, {notch1},
-							n_elements_in_x_for_coarse_mesh, parameter.nbr_global_refinements, parameter.nbr_holeEdge_refinements );
+							n_elements_in_x_for_coarse_mesh, parameter.nbr_global_refinements, parameter.nbr_holeEdge_refinements, state );
 
 		// Local refinements
 		 if ( notch_twice )
 		 {
+			 // Only the children of the band cells are tested again on the next level
+			 numEx::RefinementRegion<dim> refinement_region ( triangulation );
 			 for ( unsigned int nbr_local_ref=0; nbr_local_ref < parameter.nbr_holeEdge_refinements; nbr_local_ref++ )
-			 {
-				for (typename Triangulation<dim>::active_cell_iterator
-							 cell = triangulation.begin_active();
-							 cell != triangulation.end(); ++cell)
-				{
-						// Find all cells that lay in an exemplary damage band
-						 if ( std::abs( cell->center()[enums::y] - ( notch_offset/width * cell->center()[enums::x] + notch_y_left ) )
-						 	  < 1.75*parameter.notchWidth/2. )
-							cell->set_refine_flag();
-				} // end for(cell)
-				triangulation.execute_coarsening_and_refinement();
-			 }
+				// Find all cells that lay in an exemplary damage band
+				 refinement_region.refine( [&] ( const typename Triangulation<dim>::active_cell_iterator &cell )
+										   {
+											   return ( std::abs( cell->center()[enums::y] - ( notch_offset/width * cell->center()[enums::x] + notch_y_left ) )
+														< 1.75*parameter.notchWidth/2. );
+										   } );
 
 			 // special case:
 			 if ( DENP_Laura )
@@ -422,41 +391,36 @@ namespace HyperRectangle
 		 }
 		 else
 		 {
+			 numEx::RefinementRegion<dim> refinement_region ( triangulation );
 			 for ( unsigned int nbr_local_ref=0; nbr_local_ref < parameter.nbr_holeEdge_refinements; nbr_local_ref++ )
-			 {
-				for (typename Triangulation<dim>::active_cell_iterator
-							 cell = triangulation.begin_active();
-							 cell != triangulation.end(); ++cell)
-				{
-						// Find all cells that lay in an exemplary damage band with size 1/4 from the y=0 face
-						if ( cell->center()[enums::y] < width )
-							cell->set_refine_flag();
-				} // end for(cell)
-				triangulation.execute_coarsening_and_refinement();
-			 }
+				// Find all cells that lay in an exemplary damage band with size 1/4 from the y=0 face
+				 refinement_region.refine( [&] ( const typename Triangulation<dim>::active_cell_iterator &cell )
+										   {
+											   return ( cell->center()[enums::y] < width );
+										   } );
 		}
 
 		// Evaluation points and the related list of them
 		 numEx::EvalPointClass<3> eval_center ( Point<3>(width-notch_depth,0,0), enums::x );
-		 numEx::EvalPointClass<3> eval_top ( Point<3>(body_dimensions[enums::x],body_dimensions[enums::y],0), enums::x );
+		 numEx::EvalPointClass<3> eval_top ( Point<3>(state.body_dimensions[enums::x],state.body_dimensions[enums::y],0), enums::x );
 
-		 eval_points_list = {eval_center,eval_top};
+		 state.eval_points_list = {eval_center,eval_top};
 	}
 	
 	// 3D grid
 	template <int dim>
-	void make_grid( Triangulation<3> &triangulation, const Parameter::GeneralParameters &parameter )
+	void make_grid( Triangulation<3> &triangulation, const Parameter::GeneralParameters &parameter, State &state=example_state )
 	{
 		parameterCollection parameters_internal;
 		const double search_tolerance = parameters_internal.search_tolerance;
 
 		// Assign the dimensions of the hyper rectangle and store them as characteristic lengths
 		 const double width = parameter.width;
-		 body_dimensions[enums::x] = width;
+		 state.body_dimensions[enums::x] = width;
 		 const double length = parameter.height;
-		 body_dimensions[enums::y] = length;
+		 state.body_dimensions[enums::y] = length;
 		 const double thickness = parameter.thickness;
-		 body_dimensions[enums::z] = thickness;
+		 state.body_dimensions[enums::z] = thickness;
 
 		 const double notch_offset = DENP_Laura ? 10. : width;
 		 // double notch for compression or bottom notch for tension
@@ -482,54 +446,52 @@ namespace HyperRectangle
 										face_normal2, enums::y, manifold_id_notch_left );
 
 		  Triangulation<2> tria_flat;
+
+		// On a distributed triangulation, the extrusion is done on an auxiliary serial triangulation
+		// that then becomes the coarse mesh of the distributed one
+		 Triangulation<dim> tria_serial;
+		 Triangulation<dim> &tria_coarse = numEx::get_serial_triangulation( triangulation, tria_serial );
+
 		// Create the 2D base mesh
+		// The extrusion requires an unrefined 2D mesh, so the minimal coarse mesh (already refined in \a make_grid_flat) is only available in 2D
+		 AssertThrow( parameter.refine_special!=enums::Mesh_HyperRectangle_coarse_and_fine_brick_minimal,
+					  ExcMessage( numEx_name+" - make_grid 3D<< The minimal coarse mesh cannot be extruded, because it is already refined. "
+												 "Please use Mesh_HyperRectangle_coarse_and_fine_brick in 3D.") );
 		 if ( notch_twice )
 			make_grid_flat( tria_flat, length, width, {notch1,notch2},
-							n_elements_in_x_for_coarse_mesh, parameter.nbr_global_refinements, parameter.nbr_holeEdge_refinements );
+							n_elements_in_x_for_coarse_mesh, parameter.nbr_global_refinements, parameter.nbr_holeEdge_refinements, state );
 		 else
 			make_grid_flat( tria_flat, length, width, {notch1},
-							n_elements_in_x_for_coarse_mesh, parameter.nbr_global_refinements, parameter.nbr_holeEdge_refinements );
+							n_elements_in_x_for_coarse_mesh, parameter.nbr_global_refinements, parameter.nbr_holeEdge_refinements, state );
 
- 		GridGenerator::extrude_triangulation( tria_flat, parameter.nbr_elementsInZ, thickness, triangulation, true );
+ 		GridGenerator::extrude_triangulation( tria_flat, parameter.nbr_elementsInZ, thickness, tria_coarse, true );
 
  		// Redo the manifold for 3D
 		 Point<3> axis_dir (0,0,1);
  		 CylindricalManifold<3> cylindrical_manifold1 (axis_dir, notch1.cyl_center);
- 		 triangulation.set_manifold( manifold_id_notch_right, cylindrical_manifold1 );
+ 		 tria_coarse.set_manifold( manifold_id_notch_right, cylindrical_manifold1 );
  		 CylindricalManifold<3> cylindrical_manifold2 (axis_dir, notch2.cyl_center);
- 		 triangulation.set_manifold( manifold_id_notch_left, cylindrical_manifold2 );
-
- 		// Set boundary IDs
- 		for (typename Triangulation<3>::active_cell_iterator
- 			 cell = triangulation.begin_active();
- 			 cell != triangulation.end(); ++cell)
- 		{
- 			for (unsigned int face=0; face < GeometryInfo<2>::faces_per_cell; ++face)
- 			  if (cell->face(face)->at_boundary())
- 			  {
- 				if ( std::abs(cell->face(face)->center()[enums::z] - 0.0) < search_tolerance)
- 					cell->face(face)->set_boundary_id(enums::id_boundary_zMinus);
- 				else if ( std::abs(cell->face(face)->center()[enums::z] - body_dimensions[enums::z]) < search_tolerance)
- 					cell->face(face)->set_boundary_id(enums::id_boundary_zPlus);
- 			  }
- 		}
-		 
+ 		 tria_coarse.set_manifold( manifold_id_notch_left, cylindrical_manifold2 );
+
+		// The lateral faces keep the IDs of the flat triangulation and the faces created by the extrusion keep the IDs of extrude_triangulation
+		// @todo The IDs zMinus and zPlus are not assigned (the former loop only visited the first four faces of each cell),
+		// so the BC on zMinus and zPlus in \a make_constraints have no effect. Assigning them changes the 3D results.
+
+		// From now on, the (isotropic) refinements are distributed over the ranks
+		 numEx::distribute_serial_triangulation( tria_coarse, triangulation );
+
 		// Local refinements
 		 if ( notch_twice )
 		 {
+			 // Only the children of the band cells are tested again on the next level
+			 numEx::RefinementRegion<dim> refinement_region ( triangulation );
 			 for ( unsigned int nbr_local_ref=0; nbr_local_ref < parameter.nbr_holeEdge_refinements; nbr_local_ref++ )
-			 {
-				for (typename Triangulation<dim>::active_cell_iterator
-							 cell = triangulation.begin_active();
-							 cell != triangulation.end(); ++cell)
-				{
-						// Find all cells that lay in an exemplary damage band
-						 if ( std::abs( cell->center()[enums::y] - ( notch_offset/width * cell->center()[enums::x] + notch_y_left ) )
-						 	  < 1.75*parameter.notchWidth/2. )
-							cell->set_refine_flag();
-				} // end for(cell)
-				triangulation.execute_coarsening_and_refinement();
-			 }
+				// Find all cells that lay in an exemplary damage band
+				 refinement_region.refine( [&] ( const typename Triangulation<dim>::active_cell_iterator &cell )
+										   {
+											   return ( std::abs( cell->center()[enums::y] - ( notch_offset/width * cell->center()[enums::x] + notch_y_left ) )
+														< 1.75*parameter.notchWidth/2. );
+										   } );
 
 			 // special case:
 			 if ( DENP_Laura )
@@ -537,26 +499,33 @@ namespace HyperRectangle
 		 }
 		 else
 		 {
+			 numEx::RefinementRegion<dim> refinement_region ( triangulation );
 			 for ( unsigned int nbr_local_ref=0; nbr_local_ref < parameter.nbr_holeEdge_refinements; nbr_local_ref++ )
-			 {
-				for (typename Triangulation<dim>::active_cell_iterator
-							 cell = triangulation.begin_active();
-							 cell != triangulation.end(); ++cell)
-				{
-						// Find all cells that lay in an exemplary damage band with size 1/4 from the y=0 face
-						if ( cell->center()[enums::y] < width )
-							cell->set_refine_flag();
-				} // end for(cell)
-				triangulation.execute_coarsening_and_refinement();
-			 }
+				// Find all cells that lay in an exemplary damage band with size 1/4 from the y=0 face
+				 refinement_region.refine( [&] ( const typename Triangulation<dim>::active_cell_iterator &cell )
+										   {
+											   return ( cell->center()[enums::y] < width );
+										   } );
 		}
 
 		// Evaluation points and the related list of them
 		 numEx::EvalPointClass<3> eval_center ( Point<3>(width-notch_depth,0,0), enums::x );
-		 numEx::EvalPointClass<3> eval_top ( Point<3>(body_dimensions[enums::x],body_dimensions[enums::y],0), enums::x );
+		 numEx::EvalPointClass<3> eval_top ( Point<3>(state.body_dimensions[enums::x],state.body_dimensions[enums::y],0), enums::x );
 
-		 eval_points_list = {eval_center,eval_top};
+		 state.eval_points_list = {eval_center,eval_top};
 	}
+
+
+	/**
+	 * Higher order mapping that follows the round notches (spherical manifolds in 2D, cylindrical manifolds in 3D) with precomputed
+	 * support points. Use it also for the \a eval_points_list, so the points are found in the curved cells.
+	 */
+	template<int dim>
+	const Mapping<dim> &get_mapping ( const Triangulation<dim> &triangulation, const unsigned int mapping_degree=2 )
+	{
+		return numEx::get_manifold_mapping( triangulation, mapping_degree );
+	}
+
 //	// 3d grid
 //	template<int dim>
 //	void make_grid( Triangulation<3> &triangulation, const Parameter::GeneralParameters &parameter )
@@ -586,7 +555,7 @@ namespace HyperRectangle
 //
 //		Triangulation<2> tria_flat;
 //		make_grid_flat( tria_flat, length, width, {notch},
-//						n_elements_in_x_for_coarse_mesh, parameter.nbr_global_refinements, parameter.nbr_holeEdge_refinements );
+//						n_elements_in_x_for_coarse_mesh, parameter.nbr_global_refinements, parameter.nbr_holeEdge_refinements, state );
 //
 //		GridGenerator::extrude_triangulation( tria_flat, parameter.nbr_elementsInZ, parameter.thickness, triangulation, true );
 //
@@ -27,15 +27,22 @@ namespace Miyauchi_shear
 	// In which coordinate direction the load shall be applied, so x/y/z.
 	 const unsigned int loading_direction = enums::x;
 
-	// Evaluation point
-	 Point<3> eval_point;
-
 	// The loaded faces:
 	 const enums::enum_boundary_ids id_boundary_load = enums::id_boundary_xPlus2;
 	 const enums::enum_boundary_ids id_boundary_secondaryLoad = enums::id_boundary_none;
 
-	// Characteristic body dimensions
-	 std::vector<double> body_dimensions (5);
+	 struct State
+	 {
+		// Evaluation point
+		 Point<3> eval_point;
+
+		// Characteristic body dimensions
+		 std::vector<double> body_dimensions = std::vector<double>(5);
+	 };
+	 State example_state;
+
+	 Point<3> &eval_point = example_state.eval_point;
+	 std::vector<double> &body_dimensions = example_state.body_dimensions;
 
 	// Some internal parameters
 	 struct parameterCollection
@@ -159,9 +166,33 @@ namespace Miyauchi_shear
 	}
 
 
+	/**
+	 * Attach the manifolds to both notch radii (also needed after loading the mesh from the \a numEx::MeshCache)
+	 * @note Only the 2D mesh exists so far (see \a make_grid).
+	 */
+	template <int dim>
+	void attach_manifolds( Triangulation<dim> &triangulation )
+	{
+		static_assert( dim==2, "Miyauchi_shear::attach_manifolds<< The notch manifolds are only available for the 2D mesh." );
+
+		parameterCollection parameters_internal;
+
+		const double widthX_notch = 15.;
+		const double radius_notch = 3./2.;
+		const double width_innerPlate = (widthX_notch/2. + radius_notch);
+
+		// For the upper radius
+		 static SphericalManifold<dim> spherical_manifold_left ( Point<dim>( -width_innerPlate, 0 ) );
+		 triangulation.set_manifold(parameters_internal.manifold_id_left_radius,spherical_manifold_left);
+
+		// For the lower radius
+		 static SphericalManifold<dim> spherical_manifold_right ( Point<dim>( width_innerPlate, 0 ) );
+		 triangulation.set_manifold(parameters_internal.manifold_id_right_radius,spherical_manifold_right);
+	}
+
 	// 2D grid
 	template <int dim>
-	void make_grid( Triangulation<2> &triangulation, const Parameter::GeneralParameters &parameter )
+	void make_grid( Triangulation<2> &triangulation, const Parameter::GeneralParameters &parameter, State &state=example_state )
 	{
 		// ToDo-assure: the use the values from the parameter file
 		const double widthX = 81.25;
@@ -170,8 +201,8 @@ namespace Miyauchi_shear
 		const double radius_notch = 3./2.;
 		const double width_innerPlate = (widthX_notch/2. + radius_notch);
 
-		body_dimensions[enums::x] = widthX;
-		body_dimensions[enums::y] = heightY_half;
+		state.body_dimensions[enums::x] = widthX;
+		state.body_dimensions[enums::y] = heightY_half;
 
 //		// Set the evaluation point
 //		if ( loading_direction == enums::y )
@@ -220,46 +251,20 @@ namespace Miyauchi_shear
 
 		}
 
-		// Clear all existing boundary ID's
-		 numEx::clear_boundary_IDs( triangulation );
-
-		//Set boundary IDs and and manifolds
-		for (typename Triangulation<dim>::active_cell_iterator
-			 cell = triangulation.begin_active();
-			 cell != triangulation.end(); ++cell)
-		{
-			for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-			  if (cell->face(face)->at_boundary())
-			  {
-				// Set boundary IDs
-				if ( std::abs(cell->face(face)->center()[enums::x] - body_dimensions[enums::x]/2.) < search_tolerance )
-				{
-					if ( cell->face(face)->center()[enums::y] > 0 )
-					{
-						cell->face(face)->set_boundary_id(enums::id_boundary_xPlus2);
-					}
-					else
-					{
-						cell->face(face)->set_boundary_id(enums::id_boundary_xPlus1);
-					}
-				}
-				else if (std::abs(cell->face(face)->center()[enums::y] - body_dimensions[enums::y]/2.) < search_tolerance )
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yPlus);
-				}
-				else if ( std::abs(cell->face(face)->center()[enums::x] + body_dimensions[enums::x]/2.) < search_tolerance )
-				{
-					if ( cell->face(face)->center()[enums::y] > 0 )
-					{
-						cell->face(face)->set_boundary_id(enums::id_boundary_xMinus2);
-					}
-					else
-					{
-						cell->face(face)->set_boundary_id(enums::id_boundary_xMinus1);
-					}
-				}
-			  }
-		}
+		// Boundary IDs of the outer faces of the specimen
+		 // The upper and lower halves of the left and right faces get separate IDs
+		 const double max_coord = std::numeric_limits<double>::max();
+		 const Point<3> upper_half_min ( -max_coord, 2.*search_tolerance, -max_coord );
+		 const Point<3> upper_half_max ( max_coord, max_coord, max_coord );
+		 numEx::BoundaryClassifier<dim> boundary_classifier ( search_tolerance );
+		 boundary_classifier.add_plane( enums::x, state.body_dimensions[enums::x]/2., enums::id_boundary_xPlus2 )
+							.restrict_to_box( upper_half_min, upper_half_max )
+							.add_plane( enums::x, state.body_dimensions[enums::x]/2., enums::id_boundary_xPlus1 )
+							.add_plane( enums::y, state.body_dimensions[enums::y]/2., enums::id_boundary_yPlus )
+							.add_plane( enums::x, -state.body_dimensions[enums::x]/2., enums::id_boundary_xMinus2 )
+							.restrict_to_box( upper_half_min, upper_half_max )
+							.add_plane( enums::x, -state.body_dimensions[enums::x]/2., enums::id_boundary_xMinus1 );
+		 boundary_classifier.apply( triangulation );
 
 		// Attach the notch radius manifolds
 		{
@@ -284,13 +289,7 @@ namespace Miyauchi_shear
 						}
 					}
 			}
-			// For the upper radius
-			 static SphericalManifold<dim> spherical_manifold_left (centre_left);
-			 triangulation.set_manifold(parameters_internal.manifold_id_left_radius,spherical_manifold_left);
-
-			// For the lower radius
-			 static SphericalManifold<dim> spherical_manifold_right (centre_right);
-			 triangulation.set_manifold(parameters_internal.manifold_id_right_radius,spherical_manifold_right);
+			attach_manifolds<dim>( triangulation );
 		}
 
 		triangulation.refine_global(parameter.nbr_global_refinements);	// ... Parameter.prm file
@@ -322,4 +321,23 @@ namespace Miyauchi_shear
 	{
 		AssertThrow(false, ExcMessage("Miyauchi_shear<< not yet implemented for 3D."));
 	}
+
+	/**
+	 * Same as \a make_grid, but loads the mesh and the \a body_dimensions from the on-disk \a numEx::MeshCache
+	 * if the same mesh was already generated before
+	 * @note Only for 2D, because the 3D mesh is not yet implemented.
+	 */
+	template <int dim>
+	void make_grid_cached( Triangulation<dim> &triangulation, const Parameter::GeneralParameters &parameter, State &state=example_state )
+	{
+		static_assert( dim==2, "Miyauchi_shear::make_grid_cached<< The mesh cache is only available for the 2D mesh." );
+
+		numEx::MeshCache<dim> mesh_cache ( numEx_name );
+		mesh_cache.add_to_key( parameter.nbr_global_refinements ).add_to_key( parameter.nbr_holeEdge_refinements )
+				  .store( state.body_dimensions );
+
+		mesh_cache.make_grid( triangulation,
+							  [&] () { make_grid<dim>( triangulation, parameter, state ); },
+							  [&] () { attach_manifolds<dim>( triangulation ); } );
+	}
 }
@@ -4,12 +4,24 @@
 #include <deal.II/grid/grid_generator.h>
 #include <deal.II/grid/grid_out.h>
 #include <deal.II/grid/manifold_lib.h>
+#include <deal.II/base/function.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/symmetric_tensor.h>
+#include <deal.II/base/quadrature.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping_q1.h>
 
 #include "../MA-Code/enumerator_list.h"
 
 #include <iostream>
 #include <fstream>
 #include <cmath>
+#include <vector>
+#include <mutex>
+#include <algorithm>
 
 using namespace dealii;
 
@@ -31,6 +43,9 @@ namespace PlateWithAHole
 	 const enums::enum_boundary_ids id_boundary_load = enums::id_boundary_yPlus;
 	 const enums::enum_boundary_ids id_boundary_secondaryLoad = enums::id_boundary_xPlus;
 
+	// Stateless example, the instances have an empty state (see numEx::ExampleInstance)
+	 struct State {};
+
 	// Some internal parameters
 	 struct parameterCollection
 	 {
@@ -171,10 +186,16 @@ namespace PlateWithAHole
 											parameter
 										);
 
-		// Clear all existing boundary ID's
-		 numEx::clear_boundary_IDs( triangulation );
+		// Boundary IDs of the top and bottom edge and of the hole
+		 numEx::BoundaryClassifier<dim> boundary_classifier ( search_tolerance );
+		 // The bottom is now all the way down to -hwidth
+		 boundary_classifier.add_plane( enums::y, -hwidth, enums::id_boundary_yMinus )	// the bottom edge
+							.add_plane( enums::y, ratio_width_To_holeRadius, enums::id_boundary_yPlus )	// the top edge
+							// the hole edge (a vertex of the face lies on the hole)
+							.add_sphere( Point<3>(), holeRadius, parameters_internal.boundary_id_hole, numEx::BoundaryClassifier<dim>::test_any_vertex );
+		 boundary_classifier.apply( triangulation );
 
-		//Set boundary IDs and manifolds
+		// Set manifold IDs
 		const Point<dim> centre (0,0);
 		for ( typename Triangulation<dim>::active_cell_iterator
 				cell = triangulation.begin_active();
@@ -185,37 +206,6 @@ namespace PlateWithAHole
 			// at boundary
 			  if (cell->face(face)->at_boundary())
 			  {
-				//Set boundary IDs
-				 // The bottom is now all the way down to -hwidth
-				if (std::abs(cell->face(face)->center()[enums::y] + hwidth) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yMinus);	// the bottom edge
-
-//					for (unsigned int vertex=0; vertex<GeometryInfo<dim>::vertices_per_face; ++vertex)
-//					 if (std::abs(cell->vertex(vertex)[enums::y] - 0) < search_tolerance)
-//					  if (std::abs(cell->vertex(vertex)[enums::x] - parameter.holeRadius) < search_tolerance)
-//					  {
-//						  // We found the cell that lies at the bottom edge next to the hole (bottom left corner)
-//						  cell->set_material_id( enums::tracked_QP );
-//						  break;
-//					  }
-				}
-				else if (std::abs(cell->face(face)->center()[1] - ratio_width_To_holeRadius) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yPlus); // the top edge
-				}
-				else
-				{
-					// Be aware that we have to access the vertex as cell->face->vertex
-					for (unsigned int vertex=0; vertex < GeometryInfo<dim>::vertices_per_face; ++vertex)
-					  if (std::abs(cell->face(face)->vertex(vertex).distance(centre) - holeRadius) < search_tolerance)
-					  {
-						  cell->face(face)->set_boundary_id(parameters_internal.boundary_id_hole);	// the hole edge
-						  break;
-					  }
-				}
-
-				// Set manifold IDs
 				for (unsigned int vertex=0; vertex < GeometryInfo<dim>::vertices_per_face; ++vertex)
 				  if (std::abs(cell->vertex(vertex).distance(centre) - holeRadius) < search_tolerance)
 				  {
@@ -345,19 +335,19 @@ namespace PlateWithAHole
 										   parameter.thickness,
 										   triangulation);
 
-		// Clear boundary ID's
-		for (typename Triangulation<dim>::active_cell_iterator
-			 cell = triangulation.begin_active();
-			 cell != triangulation.end(); ++cell )
-		{
-			for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-			  if (cell->face(face)->at_boundary())
-			  {
-				  cell->face(face)->set_all_boundary_ids(0);
-			  }
-		}
-
-		// Set boundary IDs and and manifolds
+		// Boundary IDs of the top and bottom, the front and back face and of the hole
+		 numEx::BoundaryClassifier<dim> boundary_classifier ( search_tolerance );
+		 // The bottom face (yMinus) is now at the negative hwidth (plate reaches from y = -hwidth to +hwidth)
+		 boundary_classifier.add_plane( enums::y, -hwidth, enums::id_boundary_yMinus )
+							.add_plane( enums::y, ratio_width_To_holeRadius, enums::id_boundary_yPlus )
+							.add_plane( enums::z, 0.0, enums::id_boundary_zMinus )
+							.add_plane( enums::z, parameter.thickness, enums::id_boundary_zPlus )
+							// The hole: Test the distance of the face vertices from the cylinder axis
+							.add_cylinder( enums::z, parameter.holeRadius, parameters_internal.boundary_id_hole, Point<3>(),
+										   numEx::BoundaryClassifier<dim>::test_any_vertex );
+		 boundary_classifier.apply( triangulation );
+
+		// Set manifolds
 		const Point<dim> direction (0,0,1);
 		const Point<dim> centre (0,0,0);
 		for (typename Triangulation<dim>::active_cell_iterator
@@ -404,53 +394,8 @@ namespace PlateWithAHole
 //						}
 //					}
 //				}
-			  // Set boundary IDs
 			  if ( cell->face(face)->at_boundary() )
 			  {
-				// The bottom face (yMinus) is now at the negative hwidth (plate reaches from y = -hwidth to +hwidth)
-				if (std::abs(cell->face(face)->center()[enums::y] + hwidth) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yMinus);
-//					// Tracked QP
-//					for (unsigned int vertex=0; vertex<GeometryInfo<dim>::vertices_per_face; ++vertex)
-//					{
-//					 if (std::abs(cell->vertex(vertex)[enums::y] - 0) < search_tolerance)
-//						if (std::abs(cell->vertex(vertex)[enums::z] - 0) < search_tolerance)
-//						  if (std::abs(cell->vertex(vertex)[enums::x] - parameter.holeRadius) < search_tolerance)
-//						  {
-//							  // We found the cell that lies at the bottom edge next to the hole (bottom left corner)
-//							  cell->set_material_id( enums::tracked_QP );
-//							  break;
-//						  }
-//					}
-				}
-				else if (std::abs(cell->face(face)->center()[1] - ratio_width_To_holeRadius) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yPlus);
-				}
-				else if (std::abs(cell->face(face)->center()[2] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_zMinus);
-				}
-				else if (std::abs(cell->face(face)->center()[2] - parameter.thickness) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_zPlus);
-				}
-				else
-				{
-					for (unsigned int vertex=0; vertex<GeometryInfo<dim>::vertices_per_face; ++vertex)
-					 {
-					 //Project the cell vertex to the XY plane and test the distance from the cylinder axis
-						Point<dim> vertex_proj = cell->vertex(vertex);
-						vertex_proj[2] = 0.0;
-						if (std::abs(vertex_proj.distance(centre) - parameter.holeRadius) < search_tolerance)
-						{
-							cell->face(face)->set_boundary_id(parameters_internal.boundary_id_hole);
-							break;
-						}
-					}
-				}
-
 				//Set manifold IDs
 				for (unsigned int vertex=0; vertex<GeometryInfo<dim>::vertices_per_face; ++vertex)
 				{
@@ -546,4 +491,341 @@ namespace PlateWithAHole
 //			}
 //		}
 	}
+
+
+	/**
+	 * Higher order mapping of the curved hole edge (spherical manifold \a manifold_id_hole of the 2D mesh) with precomputed
+	 * support points, e.g. for \a compute_error_norms
+	 */
+	template<int dim>
+	const Mapping<dim> &get_mapping ( const Triangulation<dim> &triangulation, const unsigned int mapping_degree=2 )
+	{
+		return numEx::get_manifold_mapping( triangulation, mapping_degree );
+	}
+
+
+	/**
+	 * Analytical solution of Kirsch for an infinite plate with a circular hole (centre at the origin, radius \a hole_radius)
+	 * under the remote uniaxial stress \a remote_stress in y-direction, the loading direction of this example
+	 * (see "Plate with a hole - Kirsch stresses and displacements_Friedlein.pdf"). \n
+	 * We evaluate the Kolosov-Muskhelishvili potentials
+	 * phi(z) = s/4 (z - 2a^2/z) and psi(z) = s/2 (z - a^2/z - a^4/z^3) with z = x + iy,
+	 * which give the displacements (zero displacement and rotation at the centre of the hole), their gradient and the stresses.
+	 * The components 0 to dim-1 are the displacements, further components (e.g. damage) are zero. \n
+	 * 2D: plane strain (\a use_plane_strain=true) or plane stress. \n
+	 * 3D: plane stress through the thickness (thin plate), so u_z = eps_zz * z with the plane z=0 fixed in z-direction.
+	 * @note The example clamps the bottom face and has a finite size, so its solution differs from the one of the infinite plate.
+	 * For a convergence study prescribe this solution as Dirichlet data on the outer boundary.
+	 * @note All points have to lie outside of the hole (r>0), because we do not check this in the vectorised evaluation.
+	 */
+	template<int dim>
+	class KirschSolution : public Function<dim>
+	{
+	public:
+		KirschSolution ( const double &hole_radius, const double &remote_stress, const double &youngs_modulus, const double &poissons_ratio,
+						 const unsigned int &n_components, const bool use_plane_strain=(dim==2) )
+		:
+		Function<dim>(n_components),
+		a_squared(hole_radius*hole_radius),
+		s(remote_stress),
+		E(youngs_modulus),
+		nu(poissons_ratio),
+		plane_strain(use_plane_strain && dim==2)
+		{
+			AssertThrow( n_components >= dim, ExcMessage(numEx_name+"<< KirschSolution: We need at least "+std::to_string(dim)+" components for the displacements."));
+
+			mu = E / ( 2. * (1.+nu) );
+			kappa = ( plane_strain ? (3.-4.*nu) : (3.-nu)/(1.+nu) );
+		}
+		virtual ~KirschSolution() {};
+
+		/**
+		 * Lamé's first parameter of the linear elastic material that belongs to the solution
+		 * (in 2D plane stress the reduced value, so sigma = lambda * tr(eps) * I + 2 mu * eps holds for the in-plane components)
+		 */
+		double get_lambda () const
+		{
+			const double lambda_3D = E*nu / ( (1.+nu)*(1.-2.*nu) );
+			if ( dim==2 && !plane_strain )
+				return 2.*mu*lambda_3D / ( lambda_3D + 2.*mu );
+			return lambda_3D;
+		}
+
+		double get_mu () const
+		{
+			return mu;
+		}
+
+		// return all components at one point
+		virtual void vector_value ( const Point<dim> &p, Vector<double> &value ) const
+		{
+			std::vector< Tensor<1,dim> > u (1);
+			evaluate_list( std::vector< Point<dim> >(1,p), &u, nullptr, nullptr );
+			value = 0;
+			for ( unsigned int i=0; i<dim; i++ )
+				value[i] = u[0][i];
+		}
+
+		// return all components at all the points (e.g. all quadrature points of a cell)
+		virtual void vector_value_list ( const std::vector<Point<dim> > &points, std::vector<Vector<double> > &values ) const
+		{
+			AssertDimension( values.size(), points.size() );
+			std::vector< Tensor<1,dim> > u ( points.size() );
+			evaluate_list( points, &u, nullptr, nullptr );
+			for ( unsigned int q=0; q<points.size(); q++ )
+			{
+				values[q] = 0;
+				for ( unsigned int i=0; i<dim; i++ )
+					values[q][i] = u[q][i];
+			}
+		}
+
+		virtual void vector_gradient ( const Point<dim> &p, std::vector<Tensor<1,dim> > &gradients ) const
+		{
+			AssertDimension( gradients.size(), this->n_components );
+			std::vector< Tensor<2,dim> > grad_u (1);
+			evaluate_list( std::vector< Point<dim> >(1,p), nullptr, &grad_u, nullptr );
+			for ( unsigned int i=0; i<this->n_components; i++ )
+				gradients[i] = ( i<dim ? grad_u[0][i] : Tensor<1,dim>() );
+		}
+
+		/**
+		 * Stress tensor at the point \a p
+		 */
+		SymmetricTensor<2,dim> stress ( const Point<dim> &p ) const
+		{
+			std::vector< SymmetricTensor<2,dim> > stresses (1);
+			evaluate_list( std::vector< Point<dim> >(1,p), nullptr, nullptr, &stresses );
+			return stresses[0];
+		}
+
+		/**
+		 * Evaluate the displacements \a u, their gradient \a grad_u (grad_u[i][j] = d u_i / d x_j) and the \a stresses at all the \a points.
+		 * Each output is optional (nullptr), otherwise it has to have the size of \a points.
+		 * We process the points in blocks: gather the coordinates and evaluate the potentials in a plain loop over small arrays on the stack
+		 * without branches, trigonometric functions or complex arithmetic (1/z = conj(z)/|z|^2), which the compiler can vectorise.
+		 */
+		void evaluate_list ( const std::vector< Point<dim> > &points, std::vector< Tensor<1,dim> > *u,
+							 std::vector< Tensor<2,dim> > *grad_u, std::vector< SymmetricTensor<2,dim> > *stresses ) const
+		{
+			const unsigned int n_points = points.size();
+			Assert( u==nullptr || u->size()==n_points, ExcDimensionMismatch(u->size(),n_points) );
+			Assert( grad_u==nullptr || grad_u->size()==n_points, ExcDimensionMismatch(grad_u->size(),n_points) );
+			Assert( stresses==nullptr || stresses->size()==n_points, ExcDimensionMismatch(stresses->size(),n_points) );
+
+			const unsigned int block_size = 8;
+			double x[block_size], y[block_size], z[block_size];
+			double u_x[block_size], u_y[block_size], u_z[block_size];
+			double dux_dx[block_size], dux_dy[block_size], duy_dx[block_size], duy_dy[block_size];
+			double duz_dx[block_size], duz_dy[block_size], duz_dz[block_size];
+			double s_xx[block_size], s_yy[block_size], s_xy[block_size];
+
+			const double A = a_squared;
+			const double A2 = a_squared*a_squared;
+			const double inv_2mu = 1. / (2.*mu);
+			// Out-of-plane strain of the plane stress state in 3D: eps_zz = -nu/E * (sigma_xx + sigma_yy)
+			 const double eps_zz_factor = ( dim==3 ? -nu/E : 0. );
+
+			for ( unsigned int q0=0; q0<n_points; q0+=block_size )
+			{
+				const unsigned int n_block = std::min( block_size, n_points-q0 );
+				for ( unsigned int q=0; q<n_block; q++ )
+				{
+					x[q] = points[q0+q][enums::x];
+					y[q] = points[q0+q][enums::y];
+					z[q] = ( dim==3 ? points[q0+q][dim-1] : 0. );
+				}
+
+				for ( unsigned int q=0; q<n_block; q++ )
+				{
+					// w = 1/z and its powers
+					 const double r2 = x[q]*x[q] + y[q]*y[q];
+					 const double wr = x[q]/r2, wi = -y[q]/r2;
+					 const double w2r = wr*wr - wi*wi, w2i = 2.*wr*wi;
+					 const double w3r = w2r*wr - w2i*wi, w3i = w2r*wi + w2i*wr;
+					 const double w4r = w2r*w2r - w2i*w2i, w4i = 2.*w2r*w2i;
+
+					// Potentials phi, psi and their derivatives (real and imaginary part)
+					 const double p_r = s/4. * ( x[q] - 2.*A*wr ), p_i = s/4. * ( y[q] - 2.*A*wi );
+					 const double dp_r = s/4. * ( 1. + 2.*A*w2r ), dp_i = s/4. * 2.*A*w2i;
+					 const double ddp_r = -s*A*w3r, ddp_i = -s*A*w3i;
+					 const double ps_r = s/2. * ( x[q] - A*wr - A2*w3r ), ps_i = s/2. * ( y[q] - A*wi - A2*w3i );
+					 const double dps_r = s/2. * ( 1. + A*w2r + 3.*A2*w4r ), dps_i = s/2. * ( A*w2i + 3.*A2*w4i );
+
+					// z*conj(phi') and z*conj(phi'')
+					 const double zdp_r = x[q]*dp_r + y[q]*dp_i, zdp_i = y[q]*dp_r - x[q]*dp_i;
+					 const double zddp_r = x[q]*ddp_r + y[q]*ddp_i, zddp_i = y[q]*ddp_r - x[q]*ddp_i;
+
+					// 2 mu (u_x + i u_y) = kappa phi - z conj(phi') - conj(psi)
+					 u_x[q] = inv_2mu * ( kappa*p_r - zdp_r - ps_r );
+					 u_y[q] = inv_2mu * ( kappa*p_i - zdp_i + ps_i );
+
+					// d/dx: kappa phi' - conj(phi') - z conj(phi'') - conj(psi')
+					 dux_dx[q] = inv_2mu * ( (kappa-1.)*dp_r - zddp_r - dps_r );
+					 duy_dx[q] = inv_2mu * ( (kappa+1.)*dp_i - zddp_i + dps_i );
+					// d/dy: i ( kappa phi' - conj(phi') + z conj(phi'') + conj(psi') )
+					 dux_dy[q] = -inv_2mu * ( (kappa+1.)*dp_i + zddp_i - dps_i );
+					 duy_dy[q] = inv_2mu * ( (kappa-1.)*dp_r + zddp_r + dps_r );
+
+					// sigma_xx + sigma_yy = 4 Re(phi'), sigma_yy - sigma_xx + 2i sigma_xy = 2 ( conj(z) phi'' + psi' )
+					 const double trace = 4. * dp_r;
+					 const double diff_r = 2. * ( x[q]*ddp_r + y[q]*ddp_i + dps_r );
+					 const double diff_i = 2. * ( x[q]*ddp_i - y[q]*ddp_r + dps_i );
+					 s_xx[q] = 0.5 * ( trace - diff_r );
+					 s_yy[q] = 0.5 * ( trace + diff_r );
+					 s_xy[q] = 0.5 * diff_i;
+
+					// u_z = eps_zz * z with d(trace)/dx = 4 Re(phi'') and d(trace)/dy = -4 Im(phi'')
+					 duz_dz[q] = eps_zz_factor * trace;
+					 u_z[q] = duz_dz[q] * z[q];
+					 duz_dx[q] = eps_zz_factor * 4.*ddp_r * z[q];
+					 duz_dy[q] = -eps_zz_factor * 4.*ddp_i * z[q];
+				}
+
+				for ( unsigned int q=0; q<n_block; q++ )
+				{
+					if ( u )
+					{
+						Tensor<1,dim> &u_q = (*u)[q0+q];
+						u_q[enums::x] = u_x[q];
+						u_q[enums::y] = u_y[q];
+						if ( dim==3 )
+							u_q[dim-1] = u_z[q];
+					}
+					if ( grad_u )
+					{
+						Tensor<2,dim> &grad_u_q = (*grad_u)[q0+q];
+						grad_u_q = 0;
+						grad_u_q[enums::x][enums::x] = dux_dx[q];
+						grad_u_q[enums::x][enums::y] = dux_dy[q];
+						grad_u_q[enums::y][enums::x] = duy_dx[q];
+						grad_u_q[enums::y][enums::y] = duy_dy[q];
+						if ( dim==3 )
+						{
+							grad_u_q[dim-1][enums::x] = duz_dx[q];
+							grad_u_q[dim-1][enums::y] = duz_dy[q];
+							grad_u_q[dim-1][dim-1] = duz_dz[q];
+						}
+					}
+					if ( stresses )
+					{
+						SymmetricTensor<2,dim> &stress_q = (*stresses)[q0+q];
+						stress_q = 0;
+						stress_q[enums::x][enums::x] = s_xx[q];
+						stress_q[enums::y][enums::y] = s_yy[q];
+						stress_q[enums::x][enums::y] = s_xy[q];
+					}
+				}
+			}
+		}
+
+	private:
+		const double a_squared;
+		const double s;
+		const double E;
+		const double nu;
+		const bool plane_strain;
+		double mu;
+		double kappa;
+	};
+
+
+	/**
+	 * Errors of a finite element solution with respect to an analytical solution
+	 */
+	struct ErrorNorms
+	{
+		// || u_h - u ||_L2
+		 double L2_displacement = 0.;
+		// || grad(u_h) - grad(u) ||_L2, the H1 seminorm
+		 double H1_seminorm_displacement = 0.;
+		// || sigma(u_h) - sigma ||_L2
+		 double L2_stress = 0.;
+		// The norms || u ||_L2, || grad(u) ||_L2 and || sigma ||_L2 of the analytical solution for relative errors
+		 double L2_displacement_exact = 0.;
+		 double H1_seminorm_displacement_exact = 0.;
+		 double L2_stress_exact = 0.;
+	};
+
+	/**
+	 * Compute the L2, H1 seminorm and stress errors of the displacement \a solution (components 0 to dim-1) with respect to the \a exact solution
+	 * by integration over all locally owned cells with the \a quadrature.
+	 * The FE stress follows from the linear elastic law of the \a exact solution (sigma = lambda tr(eps) I + 2 mu eps),
+	 * so the stress error is only meaningful for the linear elastic convergence study.
+	 * The cells are split into chunks that are processed in parallel (one FEValues per chunk), each chunk adds its contribution
+	 * to the squared norms once. On a distributed triangulation we sum the contributions of all processes,
+	 * so each process gets the global norms. \n
+	 * @note On a distributed triangulation the \a solution has to contain the ghost entries of the locally owned cells.
+	 */
+	template<int dim, typename VectorType>
+	ErrorNorms compute_error_norms ( const DoFHandler<dim> &dof_handler, const VectorType &solution, const KirschSolution<dim> &exact,
+									 const Quadrature<dim> &quadrature, const Mapping<dim> &mapping = StaticMappingQ1<dim>::mapping )
+	{
+		std::vector< typename DoFHandler<dim>::active_cell_iterator > cells;
+		cells.reserve( dof_handler.get_triangulation().n_active_cells() );
+		for ( typename DoFHandler<dim>::active_cell_iterator
+			  cell = dof_handler.begin_active();
+			  cell != dof_handler.end(); ++cell )
+			if ( cell->is_locally_owned() )
+				cells.push_back( cell );
+
+		const double lambda = exact.get_lambda();
+		const double mu = exact.get_mu();
+		const FEValuesExtractors::Vector displacement (0);
+
+		// [0-2] errors, [3-5] exact norms (all squared)
+		 std::vector<double> sums ( 6, 0. );
+		 std::mutex sums_mutex;
+
+		parallel::apply_to_subranges( 0u, static_cast<unsigned int>(cells.size()),
+									  [&] ( const unsigned int begin, const unsigned int end )
+									  {
+										  FEValues<dim> fe_values ( mapping, dof_handler.get_fe(), quadrature,
+																	update_values | update_gradients | update_quadrature_points | update_JxW_values );
+										  const unsigned int n_q_points = quadrature.size();
+										  std::vector< Tensor<1,dim> > u_h ( n_q_points ), u ( n_q_points );
+										  std::vector< Tensor<2,dim> > grad_u_h ( n_q_points ), grad_u ( n_q_points );
+										  std::vector< SymmetricTensor<2,dim> > stress ( n_q_points );
+										  double sums_subrange[6] = { 0., 0., 0., 0., 0., 0. };
+
+										  for ( unsigned int c=begin; c<end; c++ )
+										  {
+											  fe_values.reinit( cells[c] );
+											  fe_values[displacement].get_function_values( solution, u_h );
+											  fe_values[displacement].get_function_gradients( solution, grad_u_h );
+											  exact.evaluate_list( fe_values.get_quadrature_points(), &u, &grad_u, &stress );
+
+											  for ( unsigned int q=0; q<n_q_points; q++ )
+											  {
+												  const SymmetricTensor<2,dim> eps_h = symmetrize( grad_u_h[q] );
+												  const SymmetricTensor<2,dim> stress_h = lambda * trace(eps_h) * unit_symmetric_tensor<dim>() + 2.*mu * eps_h;
+												  const double JxW = fe_values.JxW(q);
+
+												  sums_subrange[0] += ( u_h[q] - u[q] ).norm_square() * JxW;
+												  sums_subrange[1] += ( grad_u_h[q] - grad_u[q] ).norm_square() * JxW;
+												  sums_subrange[2] += scalar_product( stress_h - stress[q], stress_h - stress[q] ) * JxW;
+												  sums_subrange[3] += u[q].norm_square() * JxW;
+												  sums_subrange[4] += grad_u[q].norm_square() * JxW;
+												  sums_subrange[5] += scalar_product( stress[q], stress[q] ) * JxW;
+											  }
+										  }
+
+										  std::lock_guard<std::mutex> lock ( sums_mutex );
+										  for ( unsigned int i=0; i<6; i++ )
+											  sums[i] += sums_subrange[i];
+									  },
+									  /*grainsize*/ 64 );
+
+		if ( numEx::is_distributed( dof_handler.get_triangulation() ) )
+			Utilities::MPI::sum( sums, dof_handler.get_triangulation().get_communicator(), sums );
+
+		ErrorNorms error_norms;
+		error_norms.L2_displacement = std::sqrt( sums[0] );
+		error_norms.H1_seminorm_displacement = std::sqrt( sums[1] );
+		error_norms.L2_stress = std::sqrt( sums[2] );
+		error_norms.L2_displacement_exact = std::sqrt( sums[3] );
+		error_norms.H1_seminorm_displacement_exact = std::sqrt( sums[4] );
+		error_norms.L2_stress_exact = std::sqrt( sums[5] );
+		return error_norms;
+	}
 }
@@ -35,8 +35,14 @@ namespace QuarterHyperCube_Merged
 	  const enums::enum_BC BC_xMinus = enums::BC_sym;
 	  const enums::enum_BC BC_xPlus = enums::BC_none;
 
-	// Evaluation point
-	 Point<3> eval_point;
+	 struct State
+	 {
+		// Evaluation point
+		 Point<3> eval_point;
+	 };
+	 State example_state;
+
+	 Point<3> &eval_point = example_state.eval_point;
 
 	 // DENP
 //	  const enums::enum_BC BC_xMinus = enums::BC_none;
@@ -116,8 +122,8 @@ namespace QuarterHyperCube_Merged
 		const double internal_width = hole_diameter + hole_division_fraction*(width - hole_diameter);
 
 		// Set the evaluation point in the top right corner
-		 eval_point[enums::x] = half_width;
-		 eval_point[enums::y] = half_length;
+		 state.eval_point[enums::x] = half_width;
+		 state.eval_point[enums::y] = half_length;
 
 		Triangulation<2> tria_quarter_plate_hole;
 		{
@@ -549,7 +555,7 @@ namespace QuarterHyperCube_Merged
  * 3D Plate with a hole: 1/8 model
  */
 	template <int dim>
-	void make_grid( Triangulation<3> &triangulation, const Parameter::GeneralParameters &parameter )
+	void make_grid( Triangulation<3> &triangulation, const Parameter::GeneralParameters &parameter, State &state=example_state )
 	{
 		parameterCollection parameters_internal;
 
@@ -581,7 +587,7 @@ namespace QuarterHyperCube_Merged
 										   triangulation);
 
 		// Set the evaluation point's z-coordinate
-		 eval_point[enums::z] = parameter.thickness/2.0;
+		 state.eval_point[enums::z] = parameter.thickness/2.0;
 
 		// Clear all existing boundary ID's
 		 numEx::clear_boundary_IDs( triangulation );
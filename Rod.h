@@ -58,17 +58,24 @@ namespace Rod
 	 struct parameterCollection
 	 {
 		const types::manifold_id manifold_id_surf = 10;
+		const types::manifold_id manifold_id_notch = 11;
 
 		const double search_tolerance = 1e-8;
 	 };
 
-	// Evaluation points: \n
-	// We want to points, one for the contraction of the center
-	// and one for the contraction of the top face.
-	// We don't know the coordinates yet, because the mesh has not yet been created.
-	// So we fill the data in make_grid.
-	// @todo We need \a dim here instead of 3, but dim is unkown at this place -> redesign
-	 std::vector< numEx::EvalPointClass<3> > eval_points_list (2, numEx::EvalPointClass<3>() );
+	 struct State
+	 {
+		// Evaluation points: \n
+		// We want to points, one for the contraction of the center
+		// and one for the contraction of the top face.
+		// We don't know the coordinates yet, because the mesh has not yet been created.
+		// So we fill the data in make_grid.
+		// @todo We need \a dim here instead of 3, but dim is unkown at this place -> redesign
+		 std::vector< numEx::EvalPointClass<3> > eval_points_list = std::vector< numEx::EvalPointClass<3> >(2, numEx::EvalPointClass<3>());
+	 };
+	 State example_state;
+
+	 std::vector< numEx::EvalPointClass<3> > &eval_points_list = example_state.eval_points_list;
 
 
 //	 // Wall: Pushing down on the cube
@@ -77,9 +84,95 @@ namespace Rod
 //	  std::shared_ptr<WallRigid<3>> rigid_wall = std::shared_ptr<WallRigid<3>>(new WallRigid<3>( {wall_point_on_plane,wall_normal_unit_vector,wall_normal_unit_vector} , {} ));
 
 
+	/**
+	 * The y-coordinates of the vertex layers for the graded mesh of the notched area, from the y0-plane to the end of the rod.
+	 * The fine part (up to the \a half_notch_length) and the coarse part are each discretised uniformly, where the coarse part takes half
+	 * of the \a n_y_cells but at most \a n_max_of_elements_in_the_coarse_area.
+	 * @note These are the layers the former anisotropic cut_y refinements and the subsequent layer shifts ended up with.
+	 */
+	inline std::vector<double> get_graded_layer_positions( const double half_length, const double half_notch_length, const unsigned int n_y_cells,
+														   const int n_max_of_elements_in_the_coarse_area )
+	{
+		const unsigned int n_coarse_y_cells = std::min( int(std::ceil(n_y_cells/2.)), n_max_of_elements_in_the_coarse_area );
+		const unsigned int n_fine_y_cells = n_y_cells - n_coarse_y_cells;
+
+		AssertThrow( n_coarse_y_cells>0 && n_fine_y_cells>0, ExcMessage("Rod<< The graded mesh needs at least one coarse and one fine cell in y-direction."));
+
+		std::vector<double> layer_positions;
+		layer_positions.reserve( n_y_cells+1 );
+		for ( unsigned int i=0; i<n_fine_y_cells; i++ )
+			layer_positions.push_back( i/double(n_fine_y_cells) * half_notch_length );
+		for ( unsigned int i=0; i<=n_coarse_y_cells; i++ )
+			layer_positions.push_back( half_notch_length + i/double(n_coarse_y_cells) * (half_length - half_notch_length) );
+
+		return layer_positions;
+	}
+
+
+	/**
+	 * Create 1/8 of the rod (x,y,z>=0, axis in y-direction) with the vertex layers at the y-coordinates \a layer_positions in one step.
+	 * The cross section is the same quarter of a disk (20 cells) that the refined cylinder has, but here it is created in 2D and extruded.
+	 * @note The \a extrude_triangulation extrudes in z-direction, so we extrude into the negative z-direction and rotate the rod into the
+	 * y-direction afterwards.
+	 */
+	inline void make_graded_eighth_cylinder( Triangulation<3> &tria, const double radius, const std::vector<double> &layer_positions,
+											 const types::manifold_id manifold_id_surf, const double search_tolerance )
+	{
+		// The quarter of the disk
+		 Triangulation<2> tria_quarter_disk;
+		 {
+			Triangulation<2> tria_disk;
+			GridGenerator::hyper_ball( tria_disk, Point<2>(), radius );
+			tria_disk.refine_global( 1 );
+
+			std::set<typename Triangulation<2>::active_cell_iterator > cells_to_remove;
+			for (typename Triangulation<2>::active_cell_iterator
+				 cell = tria_disk.begin_active();
+				 cell != tria_disk.end(); ++cell)
+			{
+				if ( cell->center()[0] < 0.0 || cell->center()[1] < 0.0 )
+					cells_to_remove.insert(cell);
+			}
+			GridGenerator::create_triangulation_with_removed_cells( tria_disk, cells_to_remove, tria_quarter_disk );
+		 }
+
+		// As for the lateral surface of the 3D mesh, only the boundary faces on the curve follow the curvature when they are refined
+		// @note We can only guarantee that the vertices sit on the curve, so we must test with their position instead of the face centre.
+		 for (typename Triangulation<2>::active_cell_iterator
+			  cell = tria_quarter_disk.begin_active();
+			  cell != tria_quarter_disk.end(); ++cell)
+		 {
+			for (unsigned int face=0; face<GeometryInfo<2>::faces_per_cell; ++face)
+				if (cell->face(face)->at_boundary())
+					for (unsigned int vertex=0; vertex<GeometryInfo<2>::vertices_per_face; ++vertex)
+						if ( std::abs( cell->face(face)->vertex(vertex).norm() - radius ) < search_tolerance )
+						{
+							cell->face(face)->set_all_manifold_ids( manifold_id_surf );
+							break;
+						}
+		 }
+		 SphericalManifold<2> spherical_manifold_2d ( (Point<2>()) );
+		 tria_quarter_disk.set_manifold( manifold_id_surf, spherical_manifold_2d );
+		 tria_quarter_disk.refine_global( 1 );
+
+		// The extrusion requires a triangulation without refinement levels
+		 Triangulation<2> tria_cross_section;
+		 GridGenerator::flatten_triangulation( tria_quarter_disk, tria_cross_section );
+
+		// Slices in ascending order at the negative y-coordinates, which become the positive y-coordinates by the rotation
+		 std::vector<double> slice_coordinates ( layer_positions.rbegin(), layer_positions.rend() );
+		 for ( unsigned int i=0; i<slice_coordinates.size(); i++ )
+			 slice_coordinates[i] *= -1.;
+		 GridGenerator::extrude_triangulation( tria_cross_section, slice_coordinates, tria );
+
+		// We rotate the rod by 90° (=std::atan(1)*2 rad) around the x-axis, so (x,y,z) becomes (x,-z,y)
+		 GridTools::rotate( std::atan(1)*2, enums::x, tria );
+	}
+
+
 	// 3D
 	template <int dim>
-	void make_grid( Triangulation<3> &triangulation, const Parameter::GeneralParameters &parameter )
+	void make_grid( Triangulation<3> &triangulation, const Parameter::GeneralParameters &parameter, State &state=example_state )
 
 	{
 		// parameterCollection that contains the boundary ids
@@ -114,7 +207,23 @@ namespace Rod
 
 		Assert(n_additional_refinements>0, ExcMessage("Rod<< Mesh not implemented for only 4 elements in total. Please increase the nbr_holeEdge_refinements to at least 1."));
 
+		// On a distributed triangulation, everything p4est cannot do (merging, anisotropic refinements, shifted vertex layers)
+		// is done on an auxiliary serial triangulation that then becomes the coarse mesh of the distributed one
+		 Triangulation<dim> tria_serial;
+		 Triangulation<dim> &tria_coarse = numEx::get_serial_triangulation( triangulation, tria_serial );
+
+		// The standard and the innermost refinement use a graded mesh in y-direction, which is built directly with its final layers
+		 const bool graded_notch_area = ( parameter.refine_special == enums::Mesh_refine_special_standard
+										  || parameter.refine_special == enums::Mesh_refine_special_innermost );
+		 std::vector<double> layer_positions;
+		 if ( graded_notch_area )
+			 layer_positions = get_graded_layer_positions( half_length, half_notch_length, 4 + n_additional_refinements,
+														   n_max_of_elements_in_the_coarse_area );
+
 		// Create in a first step the triangulation representing 1/8 of a cylinder
+		 if ( graded_notch_area )
+			 make_graded_eighth_cylinder( tria_coarse, radius, layer_positions, parameters_internal.manifold_id_surf, search_tolerance );
+		 else
 		 {
 			// First we create a cylinder
 			 Triangulation<dim> tria_full_cylinder;
@@ -143,58 +252,25 @@ namespace Rod
 			}
 			Assert(cells_to_remove.size() > 0, ExcInternalError());
 			Assert(cells_to_remove.size() != tria_full_cylinder.n_active_cells(), ExcInternalError());
-			GridGenerator::create_triangulation_with_removed_cells(tria_full_cylinder,cells_to_remove,triangulation);
+			GridGenerator::create_triangulation_with_removed_cells(tria_full_cylinder,cells_to_remove,tria_coarse);
 		 }
 
-		// Clear all existing boundary ID's
-		 numEx::clear_boundary_IDs( triangulation );
-
-
-		// Set boundary IDs and and manifolds
-		for (typename Triangulation<dim>::active_cell_iterator
-			 cell = triangulation.begin_active();
-			 cell != triangulation.end(); ++cell)
-		{
-			for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-			 // Cells that describe the boundary can only describe the boundary when they possess a face that lies at the boundary:
-			  if (cell->face(face)->at_boundary())
-			  {
-				// Cell at the x0-plane
-				 if (std::abs(cell->face(face)->center()[x] - 0.0) < search_tolerance)
-					cell->face(face)->set_boundary_id(enums::id_boundary_xMinus);
-				// Cell at the y0-plane
-				 else if (std::abs(cell->face(face)->center()[y] - 0.0) < search_tolerance)
-						cell->face(face)->set_boundary_id(enums::id_boundary_yMinus);
-				// Cell at the z0-plane
-				 else if (std::abs(cell->face(face)->center()[z] - 0.0) < search_tolerance)
-						cell->face(face)->set_boundary_id(enums::id_boundary_zMinus);
-				// Cell at the other end of the rod
-				 else if (std::abs(cell->face(face)->center()[y] - half_length) < search_tolerance)
-						cell->face(face)->set_boundary_id(enums::id_boundary_yPlus);
-				 else
-				 {
-					  for (unsigned int vertex=0; vertex<GeometryInfo<dim>::vertices_per_face; ++vertex )
-					  {
-						 // Compute the projected radius in the xz-plane, so the distance between the vertex \a node and the y-axis
-						  Point<dim> node = cell->face(face)->vertex(vertex);
-						  double distance_2d_xz = std::sqrt( node[x]*node[x] + node[z]*node[z] );
-
-						 if ( std::abs(distance_2d_xz - radius) < search_tolerance )
-						 {
-							cell->face(face)->set_boundary_id(enums::id_boundary_zPlus);
-							break;
-						 }
-					  }
-				 }
-			  }
-		}
+		// Boundary IDs of the symmetry planes and the loaded end of the quarter rod
+		 numEx::BoundaryClassifier<dim> boundary_classifier ( search_tolerance );
+		 boundary_classifier.add_plane( x, 0.0, enums::id_boundary_xMinus )	// Faces at the x0-plane
+							.add_plane( y, 0.0, enums::id_boundary_yMinus )	// Faces at the y0-plane
+							.add_plane( z, 0.0, enums::id_boundary_zMinus )	// Faces at the z0-plane
+							.add_plane( y, half_length, enums::id_boundary_yPlus )	// Faces at the other end of the rod
+							// Faces on the lateral surface, so the distance between a vertex and the y-axis equals the radius
+							.add_cylinder( y, radius, enums::id_boundary_zPlus, Point<3>(), numEx::BoundaryClassifier<dim>::test_any_vertex );
+		 boundary_classifier.apply( tria_coarse );
 
 		// Attach a manifold to the curved boundary
 		// @todo repair this, inner cells are placed chaotically
 		// @note We can only guarantee that the vertices sit on the curve, so we must test with their position instead of the cell centre.
 		for (typename Triangulation<dim>::active_cell_iterator
-		   cell = triangulation.begin_active();
-		   cell != triangulation.end(); ++cell)
+		   cell = tria_coarse.begin_active();
+		   cell != tria_coarse.end(); ++cell)
 		{
 		  for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
 			if (cell->face(face)->at_boundary())
@@ -216,74 +292,13 @@ namespace Rod
 
 		// Create a cylindrical manifold to be put on the outer cylindrical surface
 		 CylindricalManifold<dim> cylindrical_manifold_3d (y); // y-axis
-		 triangulation.set_manifold( parameters_internal.manifold_id_surf, cylindrical_manifold_3d );
+		 tria_coarse.set_manifold( parameters_internal.manifold_id_surf, cylindrical_manifold_3d );
 
 		double cell_size_innermost = 9e9;
-		if ( parameter.refine_special == enums::Mesh_refine_special_standard || parameter.refine_special == enums::Mesh_refine_special_innermost )
+		if ( graded_notch_area )
 		{
-			// Global refinement of the mesh to get a better approximation of the contour:\n
-			// Previous: 2 elements for quarter arc; After global refinement: 4 elements
-			 triangulation.refine_global( 1 );
-
-			// Add some local refinements:
-			// Cells are cut in y-direction, so we simple get some more cells that will be rearranged subsequently
-			// @note For some reason I cannot cut_y two cells that lie next to each other. Hence, I only refine the cell at the y0-plane
-			 for (unsigned int refine_counter=0; refine_counter < n_additional_refinements; refine_counter++)
-			 {
-				for (typename Triangulation<dim>::active_cell_iterator
-				   cell = triangulation.begin_active();
-				   cell != triangulation.end(); ++cell)
-				{
-					for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-						if (cell->face(face)->at_boundary())
-							if ( std::abs(cell->face(face)->center()[y])<search_tolerance )
-							{
-								cell->set_refine_flag(RefinementCase<dim>::cut_y); // refine only in the y-direction
-								break;
-							}
-				}
-				triangulation.execute_coarsening_and_refinement();
-			 }
-
-		  // Shift the refinement layers in y-direction:
-		  // This is a bit tricky and can best be comprehended on paper for specific example values.
-			double initial_pos, new_pos;
-
-			const unsigned int nbr_of_y_cells = 4 + n_additional_refinements;
-			unsigned int nbr_of_coarse_y_cells = std::min(int(std::ceil(nbr_of_y_cells/2.)),n_max_of_elements_in_the_coarse_area);
-			const unsigned int nbr_of_fine_y_cells = nbr_of_y_cells - nbr_of_coarse_y_cells;
-
-			// Shift the coarsest cells such that the coarser outer area is uniformly discretised
-			 for ( unsigned int i=1; i<=3; i++ )
-			 {
-				initial_pos = half_length * (4-i)/4.;
-				new_pos = (nbr_of_coarse_y_cells - i)/double(nbr_of_coarse_y_cells) * (half_length - half_notch_length) + half_notch_length;
-				numEx::shift_vertex_layer( triangulation, initial_pos, new_pos, y );
-			 }
-
-			// We have to grab a few more cells from the local refinements in case we want more than 9 cells in y-direction
-			 if ( nbr_of_coarse_y_cells>4 )
-				for ( unsigned int i=3; i<=(nbr_of_coarse_y_cells-2); i++ )
-				{
-					initial_pos = half_length * 1./(std::pow(2,i));
-					new_pos = (nbr_of_coarse_y_cells-1 - i)/double(nbr_of_coarse_y_cells) * (half_length - half_notch_length) + half_notch_length;
-					numEx::shift_vertex_layer( triangulation, initial_pos, new_pos, y );
-				}
-
-			// A small trick to get this general framework to operate even for the two lowest refinements 1 and 2
-			 if ( n_additional_refinements <= 2 )
-				 nbr_of_coarse_y_cells = 4;
-
-			// Now we are down to the notch length
-			 for ( unsigned int i=(nbr_of_coarse_y_cells-1); i<=(n_additional_refinements+2); i++ )
-			 {
-				initial_pos = half_length * 1./(std::pow(2,i));
-				new_pos = (nbr_of_y_cells-1 - i)/double(nbr_of_fine_y_cells)  * half_notch_length;
-				numEx::shift_vertex_layer( triangulation, initial_pos, new_pos, y );
-			 }
-
-			// We store the size of the innermost cell from the last new_pos
-			 cell_size_innermost = new_pos;
+			// The mesh already has its final layers, so we only store the size of the innermost cell
+			 cell_size_innermost = layer_positions[1];
 		}
 		else if ( parameter.refine_special == enums::Rod_refine_special_uniform )
 		{
@@ -293,7 +308,7 @@ namespace Rod
 		{
 			// Global refinement of the mesh to get a better approximation of the contour:\n
 			// Previous: 2 elements for quarter arc; After global refinement: 4 elements
-			 triangulation.refine_global( 1 );
+			 tria_coarse.refine_global( 1 );
 
 //				for (typename Triangulation<dim>::active_cell_iterator
 //				   cell = triangulation.begin_active();
@@ -315,8 +330,8 @@ namespace Rod
 			 for (unsigned int refine_counter=0; refine_counter < n_additional_refinements; refine_counter++)
 			 {
 				for (typename Triangulation<dim>::active_cell_iterator
-				   cell = triangulation.begin_active();
-				   cell != triangulation.end(); ++cell)
+				   cell = tria_coarse.begin_active();
+				   cell != tria_coarse.end(); ++cell)
 				{
 					for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
 						if (cell->face(face)->at_boundary())
@@ -326,7 +341,7 @@ namespace Rod
 								break;
 							}
 				}
-				triangulation.execute_coarsening_and_refinement();
+				tria_coarse.execute_coarsening_and_refinement();
 			 }
 		}
 		else if ( parameter.refine_special == enums::Mesh_refine_uniform )
@@ -335,8 +350,8 @@ namespace Rod
 			 for (unsigned int refine_counter=0; refine_counter < n_additional_refinements; refine_counter++)
 			 {
 				for (typename Triangulation<dim>::active_cell_iterator
-				   cell = triangulation.begin_active();
-				   cell != triangulation.end(); ++cell)
+				   cell = tria_coarse.begin_active();
+				   cell != tria_coarse.end(); ++cell)
 				{
 //					const Point<dim> cell_centre = cell->center();
 //					const double radius_xz = std::sqrt( cell_centre[enums::x]*cell_centre[enums::x] + cell_centre[enums::z]*cell_centre[enums::z] );
@@ -360,7 +375,7 @@ namespace Rod
 						}
 					}
 				}
-				triangulation.execute_coarsening_and_refinement();
+				tria_coarse.execute_coarsening_and_refinement();
 			 }
 		}
 //		else if ( parameter.refine_special == enums::Mesh_refine_y )
@@ -430,6 +445,32 @@ namespace Rod
 //			 cell_size_innermost = new_pos;
 //		}
 
+		// On a distributed triangulation, the notch would be lost when p4est recreates the cells on refinement and repartitioning.
+		// So we notch the coarse mesh and let the notched manifolds place all new vertices (also for the faces on the lateral surface).
+		 const bool notched = ( std::abs( parameter.ratio_x - 1. ) > 1e-10 );
+		 if ( notched && numEx::is_distributed(triangulation) )
+		 {
+			numEx::notch_body( tria_coarse, half_notch_length, radius, notch_radius, R, notch_type, true );
+
+			for (typename Triangulation<dim>::active_cell_iterator
+				 cell = tria_coarse.begin_active();
+				 cell != tria_coarse.end(); ++cell)
+				cell->set_manifold_id( parameters_internal.manifold_id_notch );
+			for (typename Triangulation<dim>::active_face_iterator
+				 face = tria_coarse.begin_active_face();
+				 face != tria_coarse.end_face(); ++face)
+				if ( face->manifold_id() != parameters_internal.manifold_id_surf )
+					face->set_manifold_id( parameters_internal.manifold_id_notch );
+
+			tria_coarse.set_manifold( parameters_internal.manifold_id_notch,
+									  numEx::NotchedRodManifold<dim>( half_notch_length, radius, notch_radius, R, notch_type ) );
+			tria_coarse.set_manifold( parameters_internal.manifold_id_surf,
+									  numEx::NotchedRodManifold<dim>( half_notch_length, radius, notch_radius, R, notch_type, /*on_surface*/true ) );
+		 }
+
+		// From now on, the (isotropic) refinements are distributed over the ranks
+		 numEx::distribute_serial_triangulation( tria_coarse, triangulation );
+
 		// Possibly some additional global isotropic refinements
 		// @todo-assure: We shifted these global refinements before the special innermost refinements, so
 		// we truely only refine the actual innermost cell.
@@ -440,32 +481,29 @@ namespace Rod
 		// innermost cell, in addition to the above refinement of the notched region
 		 if ( parameter.refine_special == enums::Mesh_refine_special_innermost )
 		 {
+			 AssertThrow( !numEx::is_distributed(triangulation),
+						  ExcMessage("Rod<< The innermost refinement uses anisotropic refinements, which are not available for distributed triangulations."));
+			// The cells at the symmetry plane y=0 are always children of the previously refined cells
+			 numEx::RefinementRegion<dim> refinement_region ( triangulation );
 			 for (unsigned int refine_counter=0; refine_counter < n_refinements_innermost; refine_counter++)
-			 {
-				for (typename Triangulation<dim>::active_cell_iterator
-				   cell = triangulation.begin_active();
-				   cell != triangulation.end(); ++cell)
-				{
-					for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-						if (cell->face(face)->at_boundary())
-							if ( std::abs(cell->face(face)->center()[y]) < search_tolerance )
-							{
-								if ( refine_counter==0 || refine_counter==2 )
-									cell->set_refine_flag(); // isotropic refinement
-								else
-									cell->set_refine_flag(RefinementCase<dim>::cut_y); // refine only in the y-direction
-								//cell->set_refine_flag(RefinementCase<dim>::cut_y); // refine only in the y-direction
-								break;
-							}
-				}
-				triangulation.execute_coarsening_and_refinement();
-			 }
+				refinement_region.refine( [&] ( const typename Triangulation<dim>::active_cell_iterator &cell )
+										  {
+											  for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
+												  if (cell->face(face)->at_boundary())
+													  if ( std::abs(cell->face(face)->center()[y]) < search_tolerance )
+														  return true;
+											  return false;
+										  },
+										  ( refine_counter==0 || refine_counter==2 )
+										  ? RefinementCase<dim>::isotropic_refinement
+										  : RefinementCase<dim>::cut_y ); // refine only in the y-direction
 		 }
 
 		// Generate the notch
 		// @note We keep on using the CylindricalManifold from above also for the notched cell faces,
 		// which should give us the nice curvature we want.
-		 if ( std::abs( parameter.ratio_x - 1. ) > 1e-10 )
+		// (On a distributed triangulation, the coarse mesh has already been notched above.)
+		 if ( notched && !numEx::is_distributed(triangulation) )
 			 numEx::notch_body( triangulation, half_notch_length, radius, notch_radius, R, notch_type, true );
 
 		// Output the triangulation as eps or inp
@@ -475,13 +513,13 @@ namespace Rod
 		 numEx::EvalPointClass<dim> eval_center ( Point<3>(notch_radius,0,0), enums::x );
 		 numEx::EvalPointClass<dim> eval_top ( Point<3>(radius,half_length,0), enums::x );
 
-		 eval_points_list = {eval_center,eval_top};
+		 state.eval_points_list = {eval_center,eval_top};
 	}
 	
 	
 	// 2d grid
 	template <int dim>
-	void make_grid( Triangulation<2> &triangulation, const Parameter::GeneralParameters &parameter )
+	void make_grid( Triangulation<2> &triangulation, const Parameter::GeneralParameters &parameter, State &state=example_state )
 	{
 		/*
 		 * Input arguments:
@@ -552,32 +590,13 @@ namespace Rod
 			}
 		 }
 
-		// Clear all existing boundary ID's
-		 numEx::clear_boundary_IDs( triangulation );
-
-		// Set boundary IDs and and manifolds
-		 for (typename Triangulation<dim>::active_cell_iterator
-			 cell = triangulation.begin_active();
-			 cell != triangulation.end(); ++cell)
-		 {
-			for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-			 // Cells that describe the boundary can only describe the boundary when they possess a face that lies at the boundary:
-			  if (cell->face(face)->at_boundary())
-			  {
-				// Faces at the x0-plane
-				 if (std::abs(cell->face(face)->center()[x] - 0.0) < search_tolerance)
-					cell->face(face)->set_boundary_id(enums::id_boundary_xMinus);
-				// Faces at right end
-				 else if (std::abs(cell->face(face)->center()[x] - radius) < search_tolerance)
-					cell->face(face)->set_boundary_id(enums::id_boundary_xPlus);
-				// Faces at the y0-plane
-				 else if (std::abs(cell->face(face)->center()[y] - 0.0) < search_tolerance)
-					cell->face(face)->set_boundary_id(enums::id_boundary_yMinus);
-				// Faces at the other y-end of the rod
-				 else if (std::abs(cell->face(face)->center()[y] - half_length) < search_tolerance)
-					cell->face(face)->set_boundary_id(enums::id_boundary_yPlus);
-			  }
-		 }
+		// Boundary IDs of the four edges of the 2D cross section of the rod
+		 numEx::BoundaryClassifier<dim> boundary_classifier ( search_tolerance );
+		 boundary_classifier.add_plane( x, 0.0, enums::id_boundary_xMinus )	// Faces at the x0-plane
+							.add_plane( x, radius, enums::id_boundary_xPlus )	// Faces at right end
+							.add_plane( y, 0.0, enums::id_boundary_yMinus )	// Faces at the y0-plane
+							.add_plane( y, half_length, enums::id_boundary_yPlus );	// Faces at the other y-end of the rod
+		 boundary_classifier.apply( triangulation );
 
 		// Shift the mesh after we have identified the boundary ids,
 		// so the determination is still independent of the actual shift
@@ -614,6 +633,9 @@ namespace Rod
 		  // ToDo-optimize: Isn't this very similar to the 3D case? Maybe merge 2D and 3D, also the surrounding code seems familiar
 		 // @todo Check use of anisotropic refinements for neighbouring elements instead of this splitting and shifting
 			// @todo Also consider the use of dII subdivided_hyper_rectangle with step_sizes for "graded meshes"
+			// Gather the unique vertices once for the entire sequence of layer shifts (no refinement in between)
+			 numEx::VertexIndex<dim> vertex_index ( triangulation );
+
 		  // Shift the refinement layers in y-direction:
 		  // This is a bit tricky and can best be comprehended on paper for specific example values.
 			double initial_pos, new_pos;
@@ -627,7 +649,7 @@ namespace Rod
 			 {
 				initial_pos = half_length * (4-i)/4.;
 				new_pos = (nbr_of_coarse_y_cells - i)/double(nbr_of_coarse_y_cells) * (half_length - half_notch_length) + half_notch_length;
-				numEx::shift_vertex_layer( triangulation, initial_pos, new_pos, y );
+				numEx::shift_vertex_layer( vertex_index, initial_pos, new_pos, y );
 			 }
 
 			// We have to grab a few more cells from the local refinements in case we want more than 9 cells in y-direction
@@ -636,7 +658,7 @@ namespace Rod
 				{
 					initial_pos = half_length * 1./(std::pow(2,i));
 					new_pos = (nbr_of_coarse_y_cells-1 - i)/double(nbr_of_coarse_y_cells) * (half_length - half_notch_length) + half_notch_length;
-					numEx::shift_vertex_layer( triangulation, initial_pos, new_pos, y );
+					numEx::shift_vertex_layer( vertex_index, initial_pos, new_pos, y );
 				}
 
 			// A small trick to get this general framework to operate even for the two lowest refinements 1 and 2
@@ -648,7 +670,7 @@ namespace Rod
 			 {
 				initial_pos = half_length * 1./(std::pow(2,i));
 				new_pos = (nbr_of_y_cells-1 - i)/double(nbr_of_fine_y_cells)  * half_notch_length;
-				numEx::shift_vertex_layer( triangulation, initial_pos, new_pos, y );
+				numEx::shift_vertex_layer( vertex_index, initial_pos, new_pos, y );
 			 }
 		}
 		else if ( parameter.refine_special == enums::Rod_refine_special_uniform )
@@ -698,7 +720,7 @@ namespace Rod
 			// Evaluation points and the related list of them
 			 numEx::EvalPointClass<3> eval_center ( Point<3>(notch_radius,0,0), enums::x );
 			 numEx::EvalPointClass<3> eval_top ( Point<3>(radius,half_length,0), enums::x );
-			 eval_points_list = {eval_center,eval_top};
+			 state.eval_points_list = {eval_center,eval_top};
 		}
 		else // @todo What is this?
 		{
@@ -718,7 +740,7 @@ namespace Rod
 			// Evaluation points and the related list of them
 			 numEx::EvalPointClass<3> eval_center ( Point<3>(radius,0,0), enums::x );
 			 numEx::EvalPointClass<3> eval_top ( Point<3>(0,half_length,0), enums::x );
-			 eval_points_list = {eval_center,eval_top};
+			 state.eval_points_list = {eval_center,eval_top};
 		}
 
 		// Possibly some additional global isotropic refinements
@@ -729,6 +751,17 @@ namespace Rod
 	}
 
 
+	/**
+	 * Higher order mapping that follows the cylindrical rod surface (\a manifold_id_surf) with precomputed support points.
+	 * Call it after \a make_grid and use it for all FEValues, so the cylindrical manifold is only evaluated once per mesh.
+	 */
+	template<int dim>
+	const Mapping<dim> &get_mapping ( const Triangulation<dim> &triangulation, const unsigned int mapping_degree=2 )
+	{
+		return numEx::get_manifold_mapping( triangulation, mapping_degree );
+	}
+
+
 	template<int dim>
 	void make_constraints ( AffineConstraints<double> &constraints, const FESystem<dim> &fe, unsigned int &n_components, DoFHandler<dim> &dof_handler_ref,
 							const bool &apply_dirichlet_bc, double &current_load_increment,
@@ -813,6 +846,11 @@ namespace Rod
 			x = 0, y = 1, z = 2
 		};
 
+		// On a distributed triangulation, everything p4est cannot do (merging, anisotropic refinements, notching)
+		// is done on an auxiliary serial triangulation that then becomes the coarse mesh of the distributed one
+		 Triangulation<dim> tria_serial;
+		 Triangulation<dim> &tria_coarse = numEx::get_serial_triangulation( triangulation, tria_serial );
+
 		Assert(n_additional_refinements>0, ExcMessage("Rod<< Mesh not implemented for only 4 elements in total. Please increase the nbr_holeEdge_refinements to at least 1."));
 
 		// Create in a first step the triangulation representing 1/8 of a cylinder
@@ -841,41 +879,22 @@ namespace Rod
 			 }
 			 Assert(cells_to_remove.size() > 0, ExcInternalError());
 			 Assert(cells_to_remove.size() != tria_full_cylinder.n_active_cells(), ExcInternalError());
-			 GridGenerator::create_triangulation_with_removed_cells(tria_full_cylinder,cells_to_remove,triangulation);
+			 GridGenerator::create_triangulation_with_removed_cells(tria_full_cylinder,cells_to_remove,tria_coarse);
 		 }
 
-		// Clear all existing boundary ID's
-		 numEx::clear_boundary_IDs( triangulation );
-
-		// Set boundary IDs and and manifolds
-		 for (typename Triangulation<dim>::active_cell_iterator
-			 cell = triangulation.begin_active();
-			 cell != triangulation.end(); ++cell)
-		 {
-			for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-			 // Cells that describe the boundary can only describe the boundary when they possess a face that lies at the boundary:
-			  if (cell->face(face)->at_boundary())
-			  {
-				// Cell at the x0-plane
-				 if (std::abs(cell->face(face)->center()[x] - 0.0) < search_tolerance)
-					cell->face(face)->set_boundary_id(enums::id_boundary_xMinus);
-				// Cell at the y0-plane
-				 else if (std::abs(cell->face(face)->center()[y] - 0.0) < search_tolerance)
-						cell->face(face)->set_boundary_id(enums::id_boundary_yMinus);
-				// Cell at the z0-plane
-				 else if (std::abs(cell->face(face)->center()[z] - 0.0) < search_tolerance)
-						cell->face(face)->set_boundary_id(enums::id_boundary_zMinus);
-				// Cell at the other end of the rod
-				 else if (std::abs(cell->face(face)->center()[y] - half_length) < search_tolerance)
-						cell->face(face)->set_boundary_id(enums::id_boundary_yPlus);
-			  }
-		 }
+		// Boundary IDs of the symmetry planes and the loaded end of the quarter rod
+		 numEx::BoundaryClassifier<dim> boundary_classifier ( search_tolerance );
+		 boundary_classifier.add_plane( x, 0.0, enums::id_boundary_xMinus )	// Faces at the x0-plane
+							.add_plane( y, 0.0, enums::id_boundary_yMinus )	// Faces at the y0-plane
+							.add_plane( z, 0.0, enums::id_boundary_zMinus )	// Faces at the z0-plane
+							.add_plane( y, half_length, enums::id_boundary_yPlus );	// Faces at the other end of the rod
+		 boundary_classifier.apply( tria_coarse );
 
 		// Attach a manifold to the curved boundary
 		// @note We can only guarantee that the vertices sit on the curve, so we must test with their position instead of the cell centre.
 		for (typename Triangulation<dim>::active_cell_iterator
-		   cell = triangulation.begin_active();
-		   cell != triangulation.end(); ++cell)
+		   cell = tria_coarse.begin_active();
+		   cell != tria_coarse.end(); ++cell)
 		{
 		  for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
 			if (cell->face(face)->at_boundary())
@@ -895,11 +914,11 @@ namespace Rod
 
 		// Create a cylindrical manifold to be put on the outer cylindrical surface
 		 CylindricalManifold<dim> cylindrical_manifold_3d (y); // y-axis
-		 triangulation.set_manifold( parameters_internal.manifold_id_surf, cylindrical_manifold_3d );
+		 tria_coarse.set_manifold( parameters_internal.manifold_id_surf, cylindrical_manifold_3d );
 
 		// Global refinement of the mesh to get a better approximation of the contour:\n
 		// Previous: 2 elements for quarter arc; After global refinement: 4 elements
-		 triangulation.refine_global( 1 );
+		 tria_coarse.refine_global( 1 );
 
 		// Add some local refinements:
 		// Cells are cut in y-direction, so we simple get some more cells that will be rearranged subsequently
@@ -907,8 +926,8 @@ namespace Rod
 		 for (unsigned int refine_counter=0; refine_counter < n_additional_refinements; refine_counter++)
 		 {
 			for (typename Triangulation<dim>::active_cell_iterator
-			   cell = triangulation.begin_active();
-			   cell != triangulation.end(); ++cell)
+			   cell = tria_coarse.begin_active();
+			   cell != tria_coarse.end(); ++cell)
 			{
 				for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
 					if (cell->face(face)->at_boundary())
@@ -918,9 +937,12 @@ namespace Rod
 							break;
 						}
 			}
-			triangulation.execute_coarsening_and_refinement();
+			tria_coarse.execute_coarsening_and_refinement();
 		 }
 
+		// Gather the unique vertices once for the entire sequence of layer shifts (no refinement in between)
+		 numEx::VertexIndex<dim> vertex_index ( tria_coarse );
+
 	  // Shift the refinement layers in y-direction:
 	  // This is a bit tricky and can best be comprehended on paper for specific example values.
 		double initial_pos, new_pos;
@@ -934,7 +956,7 @@ namespace Rod
 		 {
 			initial_pos = half_length * (4-i)/4.;
 			new_pos = (nbr_of_coarse_y_cells - i)/double(nbr_of_coarse_y_cells) * (half_length - half_notch_length) + half_notch_length;
-			numEx::shift_vertex_layer( triangulation, initial_pos, new_pos, y );
+			numEx::shift_vertex_layer( vertex_index, initial_pos, new_pos, y );
 		 }
 
 		// We have to grab a few more cells from the local refinements in case we want more than 9 cells in y-direction
@@ -943,7 +965,7 @@ namespace Rod
 			{
 				initial_pos = half_length * 1./(std::pow(2,i));
 				new_pos = (nbr_of_coarse_y_cells-1 - i)/double(nbr_of_coarse_y_cells) * (half_length - half_notch_length) + half_notch_length;
-				numEx::shift_vertex_layer( triangulation, initial_pos, new_pos, y );
+				numEx::shift_vertex_layer( vertex_index, initial_pos, new_pos, y );
 			}
 
 		// A small trick to get this general framework to operate even for the two lowest refinements 1 and 2
@@ -955,11 +977,14 @@ namespace Rod
 		 {
 			initial_pos = half_length * 1./(std::pow(2,i));
 			new_pos = (nbr_of_y_cells-1 - i)/double(nbr_of_fine_y_cells)  * half_notch_length;
-			numEx::shift_vertex_layer( triangulation, initial_pos, new_pos, y );
+			numEx::shift_vertex_layer( vertex_index, initial_pos, new_pos, y );
 		 }
 
 		// Generate the notch
-		 numEx::notch_body( triangulation, half_notch_length, radius, notch_radius, R, notch_type, true );
+		 numEx::notch_body( tria_coarse, half_notch_length, radius, notch_radius, R, notch_type, true );
+
+		// From now on, the (isotropic) refinements are distributed over the ranks
+		 numEx::distribute_serial_triangulation( tria_coarse, triangulation );
 
 		// Possibly some additional global isotropic refinements
 		 triangulation.refine_global(n_global_refinements);	// ... Parameter.prm file
@@ -13,6 +13,9 @@ using namespace dealii;
 
 namespace Rod
 {
+	// Stateless example, the instances have an empty state (see numEx::ExampleInstance)
+	 struct State {};
+
 	class parameterCollection
 	{
 	public:
@@ -27,8 +27,14 @@ namespace SingleEdgeNotchedPlate
 	 const enums::enum_boundary_ids id_boundary_load = enums::id_boundary_yPlus;
 	 const enums::enum_boundary_ids id_boundary_secondaryLoad = enums::id_boundary_xPlus;
 
-	// Characteristic body dimensions
-	 std::vector<double> body_dimensions (5);
+	 struct State
+	 {
+		// Characteristic body dimensions
+		 std::vector<double> body_dimensions = std::vector<double>(5);
+	 };
+	 State example_state;
+
+	 std::vector<double> &body_dimensions = example_state.body_dimensions;
 
 	// Some internal parameters
 	 struct parameterCollection
@@ -433,7 +439,7 @@ namespace SingleEdgeNotchedPlate
 
 // 2d grid
 	template <int dim>
-	void make_grid( Triangulation<2> &triangulation, const Parameter::GeneralParameters &parameter )
+	void make_grid( Triangulation<2> &triangulation, const Parameter::GeneralParameters &parameter, State &state=example_state )
 	{
 		parameterCollection parameters_internal;
 
@@ -442,8 +448,8 @@ namespace SingleEdgeNotchedPlate
 		const double width = parameter.width;
 		const double height = parameter.width/2.;
 
-		body_dimensions[enums::x] = width;
-		body_dimensions[enums::y] = height;
+		state.body_dimensions[enums::x] = width;
+		state.body_dimensions[enums::y] = height;
 
 		// The points that span the brick
 		 Point<dim> p1 (0,0);
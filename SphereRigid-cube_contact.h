@@ -53,9 +53,6 @@ namespace SphereRigid_Cube
 	 const enums::enum_boundary_ids id_boundary_load = enums::id_boundary_yPlus;
 	 const enums::enum_boundary_ids id_boundary_secondaryLoad = enums::id_boundary_none;
 
-	// Characteristic body dimensions
-	 std::vector<double> body_dimensions (5);
-
 	// Some internal parameters
 	 struct parameterCollection
 	 {
@@ -81,29 +78,104 @@ namespace SphereRigid_Cube
 	// Punch
 	 Point<2> punch_center = Point<2>(0.0,sheet_thickness + punch_radius + 1e-6);
 	 const Point<2> punch_loading_vector = Point<2>(0.,-1.);
-	 std::shared_ptr<SphereRigid<2>> rigid_punch = std::shared_ptr<SphereRigid<2>>(new SphereRigid<2>( {punch_center,punch_loading_vector,punch_loading_vector}, {punch_radius,0,0} ));
+	 inline std::shared_ptr<SphereRigid<2>> create_rigid_punch ()
+	 {
+		return std::shared_ptr<SphereRigid<2>>(new SphereRigid<2>( {punch_center,punch_loading_vector,punch_loading_vector}, {punch_radius,0,0} ));
+	 }
 
 	// Wall on the bottom (half wall extending to the left)
 	 Point<2> wall_point_on_plane = Point<2>(die_width_bottom,-die_depth);
 	 const Point<2> wall_normal_unit_vector = Point<2>(0,1.0);
-	 std::shared_ptr<HalfWallRigid<2>> rigid_bottom = std::shared_ptr<HalfWallRigid<2>>(new HalfWallRigid<2>( {wall_point_on_plane,wall_normal_unit_vector,wall_normal_unit_vector} , {-1.} ));
+	 inline std::shared_ptr<HalfWallRigid<2>> create_rigid_bottom ()
+	 {
+		return std::shared_ptr<HalfWallRigid<2>>(new HalfWallRigid<2>( {wall_point_on_plane,wall_normal_unit_vector,wall_normal_unit_vector} , {-1.} ));
+	 }
 
 	// Die on the right
 	 Point<2> die_right_center = Point<2>(die_diameter,-die_outer_radius_edge);
 	 const Point<2> die_ref_vector = Point<2>(0.,-1.);
 	 const double sphere_left = die_width_bottom;
 	 const double sphere_right = die_diameter;
-	 std::shared_ptr<SphereRigid<2>> rigid_die = std::shared_ptr<SphereRigid<2>>(new SphereRigid<2>( {die_right_center,die_ref_vector,die_ref_vector}, {die_outer_radius_edge,sphere_left,sphere_right} ));
+	 inline std::shared_ptr<SphereRigid<2>> create_rigid_die ()
+	 {
+		return std::shared_ptr<SphereRigid<2>>(new SphereRigid<2>( {die_right_center,die_ref_vector,die_ref_vector}, {die_outer_radius_edge,sphere_left,sphere_right} ));
+	 }
 
 	// Wall on the right as support
 	 Point<2> die_point_on_plane = Point<2>(die_diameter,-1e-6);
 	 const Point<2> die_normal_unit_vector = Point<2>(0,1.);
-	 std::shared_ptr<HalfWallRigid<2>> rigid_support = std::shared_ptr<HalfWallRigid<2>>(new HalfWallRigid<2>( {die_point_on_plane,die_normal_unit_vector,die_normal_unit_vector} , {1.} ));
+	 inline std::shared_ptr<HalfWallRigid<2>> create_rigid_support ()
+	 {
+		return std::shared_ptr<HalfWallRigid<2>>(new HalfWallRigid<2>( {die_point_on_plane,die_normal_unit_vector,die_normal_unit_vector} , {1.} ));
+	 }
 
 	// Wall for holder
 	 Point<2> holder_point_on_plane = Point<2>(die_diameter,sheet_thickness);
 	 const Point<2> holder_normal_unit_vector = Point<2>(0,-1.);
-	 std::shared_ptr<HalfWallRigid<2>> rigid_holder = std::shared_ptr<HalfWallRigid<2>>(new HalfWallRigid<2>( {holder_point_on_plane,holder_normal_unit_vector,holder_normal_unit_vector} , {1.} ));
+	 inline std::shared_ptr<HalfWallRigid<2>> create_rigid_holder ()
+	 {
+		return std::shared_ptr<HalfWallRigid<2>>(new HalfWallRigid<2>( {holder_point_on_plane,holder_normal_unit_vector,holder_normal_unit_vector} , {1.} ));
+	 }
+
+	// Broad phase of the contact search: the boundary faces that each rigid body can touch (in the order of the body indices)
+	// and the skin of the Verlet list (the candidates are kept until a body or the sheet moved by half of it)
+	 const unsigned int body_punch = 0;
+	 const unsigned int body_die = 1;
+	 const unsigned int body_bottom = 2;
+	 const unsigned int body_holder = 3;
+	 const unsigned int body_support = 4;
+	 const double contact_search_skin = 0.1 * sheet_thickness;
+	 template<int dim>
+	 numEx::ContactBroadPhase<dim> create_contact_broad_phase ()
+	 {
+		return numEx::ContactBroadPhase<dim>( contact_search_skin, {enums::id_boundary_yPlus, enums::id_boundary_yMinus, enums::id_boundary_yMinus,
+																	enums::id_boundary_yPlus2, enums::id_boundary_yMinus} );
+	 }
+
+	 struct State
+	 {
+		// Characteristic body dimensions
+		 std::vector<double> body_dimensions = std::vector<double>(5);
+
+		// Rigid bodies (the punch is moved in make_constraints)
+		 std::shared_ptr<SphereRigid<2>> rigid_punch = create_rigid_punch();
+		 std::shared_ptr<HalfWallRigid<2>> rigid_bottom = create_rigid_bottom();
+		 std::shared_ptr<SphereRigid<2>> rigid_die = create_rigid_die();
+		 std::shared_ptr<HalfWallRigid<2>> rigid_support = create_rigid_support();
+		 std::shared_ptr<HalfWallRigid<2>> rigid_holder = create_rigid_holder();
+
+		// Travel of the punch along its loading vector, the sum of all increments passed to rigid_punch->move
+		 double punch_travel = 0.;
+
+		// Broad phase of the contact search in 2D and 3D
+		 numEx::ContactBroadPhase<2> contact_broad_phase = create_contact_broad_phase<2>();
+		 numEx::ContactBroadPhase<3> contact_broad_phase_3d = create_contact_broad_phase<3>();
+	 };
+	 State example_state;
+
+	 std::vector<double> &body_dimensions = example_state.body_dimensions;
+	 std::shared_ptr<SphereRigid<2>> &rigid_punch = example_state.rigid_punch;
+	 std::shared_ptr<HalfWallRigid<2>> &rigid_bottom = example_state.rigid_bottom;
+	 std::shared_ptr<SphereRigid<2>> &rigid_die = example_state.rigid_die;
+	 std::shared_ptr<HalfWallRigid<2>> &rigid_support = example_state.rigid_support;
+	 std::shared_ptr<HalfWallRigid<2>> &rigid_holder = example_state.rigid_holder;
+	 double &punch_travel = example_state.punch_travel;
+	 numEx::ContactBroadPhase<2> &contact_broad_phase = example_state.contact_broad_phase;
+	 numEx::ContactBroadPhase<3> &contact_broad_phase_3d = example_state.contact_broad_phase_3d;
+
+	// The broad phase for the dimension of the triangulation
+	 template<int dim>
+	 numEx::ContactBroadPhase<dim> &get_contact_broad_phase ( State &state=example_state );
+	 template<>
+	 inline numEx::ContactBroadPhase<2> &get_contact_broad_phase<2> ( State &state )
+	 {
+		return state.contact_broad_phase;
+	 }
+	 template<>
+	 inline numEx::ContactBroadPhase<3> &get_contact_broad_phase<3> ( State &state )
+	 {
+		return state.contact_broad_phase_3d;
+	 }
 
 	 // Conical punch
 //	 Point<2> punch_center = Point<2>(0.0,1.01);
@@ -114,7 +186,7 @@ namespace SphereRigid_Cube
 
 	template<int dim>
 	void make_constraints ( AffineConstraints<double> &constraints, const FESystem<dim> &fe, unsigned int &n_components, DoFHandler<dim> &dof_handler_ref,
-							const bool &apply_dirichlet_bc, double &current_load_increment )
+							const bool &apply_dirichlet_bc, double &current_load_increment, State &state=example_state )
 	{
 		/* inputs:
 		 * dof_handler_ref,
@@ -165,7 +237,13 @@ namespace SphereRigid_Cube
 															fe.component_mask(y_displacement)
 														);
 			else if ( loading_type==enums::loading_by_contact )
-				rigid_punch->move(current_load_increment);
+			{
+				// The 3D contact assembly places the punch by its travel (see get_punch_geometry),
+				// the point-wise punch of the contact library is only moved for the 2D model
+				 if ( dim==2 )
+					 state.rigid_punch->move(current_load_increment);
+				 state.punch_travel += current_load_increment;
+			}
 
 
 		}
@@ -207,6 +285,20 @@ namespace SphereRigid_Cube
 			}
 		}
 
+		// Quarter model in 3D: symmetry plane z=0 and the outer face zPlus clamped as xPlus
+		if ( dim==3 )
+		{
+			numEx::BC_apply( enums::id_boundary_zMinus, enums::z, 0, apply_dirichlet_bc, dof_handler_ref, fe, constraints );
+
+			VectorTools::interpolate_boundary_values(
+														dof_handler_ref,
+														enums::id_boundary_zPlus,
+														ZeroFunction<dim> (n_components),
+														constraints,
+														fe.component_mask(displacement)
+													);
+		}
+
 		// Niederhalter
 //		if ( true )
 //		{
@@ -247,8 +339,8 @@ namespace SphereRigid_Cube
 			if ( meshing_ratio==0 )
 				AssertThrow(false, ExcMessage("SphereRigid-cube - make_grid << Automatic mesh ratio is zero. Please modify the computation"));
 
-			body_dimensions[enums::x] = x_position[1];
-			body_dimensions[enums::x] = y_position[1];
+			state.body_dimensions[enums::x] = x_position[1];
+			state.body_dimensions[enums::x] = y_position[1];
 
 			// Only one block
 		//	GridGenerator::hyper_cube (triangulation,x_position[0],x_position[1]);
@@ -363,14 +455,58 @@ namespace SphereRigid_Cube
 
 
 // 3d grid
+	/**
+	 * Quarter model of the sheet (x>=0, z>=0) with the symmetry planes x=0 (xMinus) and z=0 (zMinus),
+	 * the outer faces xPlus and zPlus are clamped. The top surface under the blank holder (radius above die_diameter) gets the id yPlus2.
+	 */
 	template <int dim>
-	void make_grid( Triangulation<3> &triangulation, const Parameter::GeneralParameters &parameter )
+	void make_grid( Triangulation<3> &triangulation, const Parameter::GeneralParameters &parameter, State &state=example_state )
 	{
-		AssertThrow( false, ExcMessage("SphereRigid-cube_contact - make_grid 3D<< not implemented"));
+		const Point<3> p1 (0., 0., 0.);
+		const Point<3> p2 (width_support, sheet_thickness, width_support);
+
+		const unsigned int meshing_ratio = width_support/sheet_thickness;
 
-		// Just to get rid of the unused variable warnings
-		 GridGenerator::hyper_cube(triangulation);
-		 std::cout << "degree " << parameter.degree << std::endl;
+		if ( meshing_ratio==0 )
+			AssertThrow(false, ExcMessage("SphereRigid-cube - make_grid 3D<< Automatic mesh ratio is zero. Please modify the computation"));
+
+		state.body_dimensions[enums::x] = p2[enums::x];
+		state.body_dimensions[enums::y] = p2[enums::y];
+		state.body_dimensions[enums::z] = p2[enums::z];
+
+		const unsigned int n_elements_per_dimension = std::pow( 2, parameter.nbr_global_refinements );
+		GridGenerator::subdivided_hyper_rectangle( triangulation, {meshing_ratio*n_elements_per_dimension, n_elements_per_dimension, meshing_ratio*n_elements_per_dimension}, p1, p2 );
+
+		//set boundary ids
+		for (auto cell: triangulation.active_cell_iterators())
+		{
+			for(unsigned int j=0; j<GeometryInfo<3>::faces_per_cell; ++j)
+			{
+				if ( !cell->face(j)->at_boundary() )
+					continue;
+
+				const Point<3> face_center = cell->face(j)->center();
+				//contact surface: rigid punch side - block
+				if ( std::abs(face_center[enums::y] - p2[enums::y]) < 1e-10 ) // top
+				{
+					if ( std::sqrt( face_center[enums::x]*face_center[enums::x] + face_center[enums::z]*face_center[enums::z] ) > die_diameter )
+						cell->face(j)->set_boundary_id(enums::id_boundary_yPlus2);
+					else
+						cell->face(j)->set_boundary_id(enums::id_boundary_yPlus);
+				}
+				//fixed surface
+				else if ( std::abs(face_center[enums::y] - p1[enums::y]) < 1e-10 )
+					cell->face(j)->set_boundary_id(enums::id_boundary_yMinus);
+				else if ( std::abs(face_center[enums::x] - p1[enums::x]) < 1e-10 ) // symmetry
+					cell->face(j)->set_boundary_id(enums::id_boundary_xMinus);
+				else if ( std::abs(face_center[enums::x] - p2[enums::x]) < 1e-10 )
+					cell->face(j)->set_boundary_id(enums::id_boundary_xPlus);
+				else if ( std::abs(face_center[enums::z] - p1[enums::z]) < 1e-10 ) // symmetry
+					cell->face(j)->set_boundary_id(enums::id_boundary_zMinus);
+				else if ( std::abs(face_center[enums::z] - p2[enums::z]) < 1e-10 )
+					cell->face(j)->set_boundary_id(enums::id_boundary_zPlus);
+			}
+		}
 
 		// include the following two scopes to see directly how the variation of the input parameters changes the geometry of the grid
 //		{
@@ -390,6 +526,138 @@ namespace SphereRigid_Cube
 //		}
 	}
 
+	/**
+	 * Dimension-independent geometry of the rigid bodies for the batched gap evaluation and the broad phase: \n
+	 * The tools are axisymmetric about the y-axis through the origin, so the 2D section x>=0 and the 3D quarter model
+	 * (x>=0, z>=0 with the symmetry planes x=0 and z=0) describe the same punch and die.
+	 * In 2D, the die edge reduces to the circle at die_right_center (limited to x in [sphere_left,sphere_right])
+	 * and the radial ranges of the walls to their extension to the left or right of the point on the plane.
+	 * @note We assume that rigid_punch->move shifts the punch by the increment along its loading vector.
+	 */
+	template<int dim>
+	Point<dim> lift_point ( const Point<2> &point_2d )
+	{
+		Point<dim> point;
+		point[enums::x] = point_2d[enums::x];
+		point[enums::y] = point_2d[enums::y];
+		return point;
+	}
+
+	template<int dim>
+	numEx::RadialRange<dim> get_radial_range ( const double rho_min, const double rho_max )
+	{
+		numEx::RadialRange<dim> radial_range;
+		radial_range.axis[enums::y] = 1.;
+		radial_range.rho_min = rho_min;
+		radial_range.rho_max = rho_max;
+		return radial_range;
+	}
+
+	template<int dim>
+	numEx::RigidSphere<dim> get_punch_geometry ( const State &state )
+	{
+		numEx::RigidSphere<dim> punch;
+		punch.center = lift_point<dim>( punch_center + state.punch_travel * punch_loading_vector );
+		punch.radius = punch_radius;
+		return punch;
+	}
+
+	template<int dim>
+	numEx::RigidDieEdge<dim> get_die_geometry ()
+	{
+		numEx::RigidDieEdge<dim> die;
+		die.axis_point[enums::y] = die_right_center[enums::y];
+		die.axis[enums::y] = 1.;
+		die.major_radius = die_right_center[enums::x];
+		die.minor_radius = die_outer_radius_edge;
+		die.radial_range = get_radial_range<dim>( sphere_left, sphere_right );
+		return die;
+	}
+
+	template<int dim>
+	numEx::RigidHalfWall<dim> get_wall_geometry ( const unsigned int body )
+	{
+		numEx::RigidHalfWall<dim> wall;
+		if ( body==body_bottom ) // inside of the die opening
+		{
+			wall.point_on_plane = lift_point<dim>( wall_point_on_plane );
+			wall.normal = lift_point<dim>( wall_normal_unit_vector );
+			wall.radial_range = get_radial_range<dim>( 0., wall_point_on_plane[enums::x] );
+		}
+		else if ( body==body_holder ) // outside of the die opening
+		{
+			wall.point_on_plane = lift_point<dim>( holder_point_on_plane );
+			wall.normal = lift_point<dim>( holder_normal_unit_vector );
+			wall.radial_range = get_radial_range<dim>( holder_point_on_plane[enums::x], std::numeric_limits<double>::infinity() );
+		}
+		else // support, outside of the die opening
+		{
+			AssertThrow( body==body_support, ExcMessage("SphereRigid_Cube<< Unknown rigid body "+std::to_string(body)+"."));
+			wall.point_on_plane = lift_point<dim>( die_point_on_plane );
+			wall.normal = lift_point<dim>( die_normal_unit_vector );
+			wall.radial_range = get_radial_range<dim>( die_point_on_plane[enums::x], std::numeric_limits<double>::infinity() );
+		}
+		return wall;
+	}
+
+	/**
+	 * Bounding boxes of the regions in which the rigid bodies detect contact at their current position: \n
+	 * The punch is bounded by its sphere, the die by its edge (only up to sphere_right) and the walls by the half space behind the wall,
+	 * the bottom additionally by its radius. Penetrating faces lie inside these boxes, faces that approach the body are caught by the skin of the broad phase.
+	 */
+	template<int dim>
+	void set_rigid_body_boxes ( State &state )
+	{
+		numEx::ContactBroadPhase<dim> &broad_phase = get_contact_broad_phase<dim>( state );
+		broad_phase.set_body_box( body_punch, get_punch_geometry<dim>( state ).get_bounding_box() );
+		broad_phase.set_body_box( body_die, get_die_geometry<dim>().get_bounding_box() );
+		for ( const unsigned int body : {body_bottom, body_holder, body_support} )
+			broad_phase.set_body_box( body, get_wall_geometry<dim>(body).get_bounding_box() );
+	}
+
+	/**
+	 * Batched gap evaluation of the rigid body \a body (see body_punch, ...) for the boundary quadrature points \a points
+	 * at their current position, e.g. all points of the candidate faces of the broad phase of this body.
+	 * The geometry is set up from the same parameters as the rigid bodies of the contact library, so in 2D the gaps agree with
+	 * their (point-wise) evaluation.
+	 */
+	template<int dim>
+	void evaluate_rigid_body_gaps ( const unsigned int body, const numEx::ContactPointBatch<dim> &points, numEx::ContactGapBatch<dim> &results,
+									const double gap_tolerance=0., const State &state=example_state )
+	{
+		if ( body==body_punch )
+			get_punch_geometry<dim>( state ).evaluate_gaps( points, results, gap_tolerance );
+		else if ( body==body_die )
+			get_die_geometry<dim>().evaluate_gaps( points, results, gap_tolerance );
+		else
+			get_wall_geometry<dim>(body).evaluate_gaps( points, results, gap_tolerance );
+	}
+
+	/**
+	 * Update the broad phase of the contact search with the current \a displacement of the sheet and the current position of the rigid bodies.
+	 * Call this once per load step after make_constraints (which moves the punch) and before the assembly.
+	 * The face boxes and the candidates are only rebuilt, if the sheet or a body moved by more than half the \a contact_search_skin.
+	 * \a assemble_contact then only evaluates the gaps of each body on its candidate faces
+	 * (see \a get_contact_broad_phase<dim>().is_candidate(cell, face, body) or get_candidates(body)).
+	 */
+	template<int dim, typename VectorType>
+	void update_contact_search ( const DoFHandler<dim> &dof_handler, const VectorType &displacement, State &state=example_state )
+	{
+		get_contact_broad_phase<dim>( state ).update_faces( dof_handler, displacement );
+		set_rigid_body_boxes<dim>( state );
+	}
+
+	/**
+	 * Frictionless penalty contact of the faces of the \a cell with all the rigid bodies (punch, die, bottom, holder, support) in 3D:
+	 * The gaps of the quadrature points at their current position are evaluated by \a evaluate_rigid_body_gaps, only for the candidate
+	 * faces of the broad phase. Penetrating points (negative gap) contribute the residual penalty_stiffness * gap * (N_i . n)
+	 * and its linearisation penalty_stiffness * (N_i . n)(N_j . n), where the change of the normal is neglected.
+	 * @note As in the Newton systems K du = -R of the deal.II tutorials, the negative residual is added to the \a cell_rhs.
+	 * @note The \a fe_face_values_ref have to provide the values, quadrature points and JxW values in the reference configuration.
+	 * @note Call \a update_contact_search once per load step before the assembly.
+	 * @note In 2D, the contact is still assembled by the contact library with the rigid bodies of the \a State
+	 * (e.g. rigid_punch, moved in make_constraints), so nothing is assembled here to not count the contact twice.
+	 */
 	template <int dim>
 	void assemble_contact
 	(
@@ -403,92 +671,73 @@ namespace SphereRigid_Cube
 			std::vector< std::shared_ptr< PointHistory<dim> > > lqph,
 			const std::vector<types::global_dof_index> local_dof_indices,
 			FullMatrix<double> &cell_matrix,
-			Vector<double> &cell_rhs
+			Vector<double> &cell_rhs,
+			State &state=example_state
 	)
 	{
-//		// Assemble the punch
-//		assemble_contact(
-//							cell,
-//							rigid_punch,
-//							enums::id_boundary_yPlus,
-//							penalty_stiffness,
-//							fe,
-//							fe_face_values_ref,
-//							u_fe,
-//							n_q_points_f,
-//							current_solution,
-//							lqph,
-//							local_dof_indices,
-//							cell_matrix,
-//							cell_rhs
-//						 );
-//
-//		// Assemble the left die
-//		assemble_contact(
-//							cell,
-//							rigid_die,
-//							enums::id_boundary_yMinus,
-//							penalty_stiffness,
-//							fe,
-//							fe_face_values_ref,
-//							u_fe,
-//							n_q_points_f,
-//							current_solution,
-//							lqph,
-//							local_dof_indices,
-//							cell_matrix,
-//							cell_rhs
-//						 );
-//
-//		// Assemble the bottom wall
-////		assemble_contact(
-////							cell,
-////							rigid_bottom,
-////							enums::id_boundary_yMinus,
-////							penalty_stiffness,
-////							fe,
-////							fe_face_values_ref,
-////							u_fe,
-////							n_q_points_f,
-////							current_solution,
-////							local_dof_indices,
-////							cell_matrix,
-////							cell_rhs
-////						 );
-//
-//
-//		// Assemble the Niederhalter
-//		assemble_contact(
-//							cell,
-//							rigid_holder,
-//							enums::id_boundary_yPlus2,
-//							penalty_stiffness,
-//							fe,
-//							fe_face_values_ref,
-//							u_fe,
-//							n_q_points_f,
-//							current_solution,
-//							lqph,
-//							local_dof_indices,
-//							cell_matrix,
-//							cell_rhs
-//						 );
-//
-//		// Assemble the support
-//		assemble_contact(
-//							cell,
-//							rigid_support,
-//							enums::id_boundary_yMinus,
-//							penalty_stiffness,
-//							fe,
-//							fe_face_values_ref,
-//							u_fe,
-//							n_q_points_f,
-//							current_solution,
-//							lqph,
-//							local_dof_indices,
-//							cell_matrix,
-//							cell_rhs
-//						 );
+		if ( dim==2 )
+			return;
+
+		const numEx::ContactBroadPhase<dim> &broad_phase = get_contact_broad_phase<dim>( state );
+		AssertThrow( broad_phase.faces_up_to_date(),
+					 ExcMessage("SphereRigid_Cube<< The contact search is outdated. Call update_contact_search before the assembly."));
+
+		// Cells without a candidate face of the broad phase cannot get into contact with any rigid body
+		 if ( !broad_phase.has_candidates(cell) )
+			 return;
+
+		const unsigned int dofs_per_cell = fe.dofs_per_cell;
+		std::vector< Tensor<1,dim> > displacements ( n_q_points_f );
+		numEx::ContactPointBatch<dim> points;
+		numEx::ContactGapBatch<dim> gaps;
+		std::vector<double> N_n ( dofs_per_cell );
+
+		for ( unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face )
+		{
+			bool face_initialised = false;
+			for ( unsigned int body=0; body<broad_phase.n_bodies(); body++ )
+			{
+				if ( !broad_phase.is_candidate( cell, face, body ) )
+					continue;
+
+				// Current positions of the quadrature points of the face
+				 if ( !face_initialised )
+				 {
+					fe_face_values_ref.reinit( cell, face );
+					fe_face_values_ref[u_fe].get_function_values( current_solution, displacements );
+					points.resize( n_q_points_f );
+					for ( unsigned int q=0; q<n_q_points_f; q++ )
+						points.set_point( q, fe_face_values_ref.quadrature_point(q) + displacements[q] );
+					points.finalize();
+					face_initialised = true;
+				 }
+
+				evaluate_rigid_body_gaps<dim>( body, points, gaps, 0., state );
+
+				for ( unsigned int q=0; q<n_q_points_f; q++ )
+				{
+					if ( gaps.active[q] == 0. || gaps.gap[q] >= 0. )
+						continue;
+
+					Tensor<1,dim> normal;
+					for ( unsigned int d=0; d<dim; d++ )
+						normal[d] = gaps.normal[d][q];
+
+					// Normal components of the shape functions
+					 for ( unsigned int i=0; i<dofs_per_cell; i++ )
+						 N_n[i] = fe_face_values_ref[u_fe].value(i,q) * normal;
+
+					const double JxW = fe_face_values_ref.JxW(q);
+					for ( unsigned int i=0; i<dofs_per_cell; i++ )
+					{
+						if ( N_n[i] == 0. )
+							continue;
+						cell_rhs(i) -= penalty_stiffness * gaps.gap[q] * N_n[i] * JxW;
+						for ( unsigned int j=0; j<dofs_per_cell; j++ )
+							cell_matrix(i,j) += penalty_stiffness * N_n[i] * N_n[j] * JxW;
+					}
+				}
+			}
+		}
 	}
 }
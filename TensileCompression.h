@@ -17,6 +17,9 @@ namespace BarModel
 {
 	static const unsigned int loading_direction = enums::x;
 
+	// Stateless example, the instances have an empty state (see numEx::ExampleInstance)
+	 struct State {};
+
 	class parameterCollection
 	{
 	public:
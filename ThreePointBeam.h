@@ -15,6 +15,9 @@ using namespace dealii;
 
 namespace ThreePointBeam
 {
+	// Stateless example, the instances have an empty state (see numEx::ExampleInstance)
+	 struct State {};
+
 	class parameterCollection
 	{
 	public:
@@ -42,17 +42,6 @@ namespace Unconstrained_elastoplastic_test
 	 const enums::enum_boundary_ids id_boundary_load = enums::id_boundary_none;
 	 const enums::enum_boundary_ids id_boundary_secondaryLoad = enums::id_boundary_none;
 
-	// Characteristic body dimensions
-	 std::vector<double> body_dimensions (5);
-	 
-	// Evaluation point
-	// @note We cannot init the point yet, because we don't have the geometry dimensions and geometry
-	 Point<3> eval_point;
-	 
-	// Evaluation path
-	 Point<3> eval_path_start;
-	 Point<3> eval_path_end;
-
 	// Some internal parameters
 	 struct parameterCollection
 	 {
@@ -62,14 +51,57 @@ namespace Unconstrained_elastoplastic_test
 		static constexpr double search_tolerance = 1e-12;
 	 };
 	 
-	// Evaluation points: \n
-	// @todo We need \a dim here instead of 2, but dim is unkown at this place -> redesign
-	 std::vector< numEx::EvalPointClass<3> > eval_points_list (2, numEx::EvalPointClass<3>() );
+	 struct State
+	 {
+		// Characteristic body dimensions
+		 std::vector<double> body_dimensions = std::vector<double>(5);
+
+		// Evaluation point
+		// @note We cannot init the point yet, because we don't have the geometry dimensions and geometry
+		 Point<3> eval_point;
+
+		// Evaluation path
+		 Point<3> eval_path_start;
+		 Point<3> eval_path_end;
+
+		// Evaluation points: \n
+		// @todo We need \a dim here instead of 2, but dim is unkown at this place -> redesign
+		 std::vector< numEx::EvalPointClass<3> > eval_points_list = std::vector< numEx::EvalPointClass<3> >(2, numEx::EvalPointClass<3>());
+	 };
+	 State example_state;
+
+	 std::vector<double> &body_dimensions = example_state.body_dimensions;
+	 Point<3> &eval_point = example_state.eval_point;
+	 Point<3> &eval_path_start = example_state.eval_path_start;
+	 Point<3> &eval_path_end = example_state.eval_path_end;
+	 std::vector< numEx::EvalPointClass<3> > &eval_points_list = example_state.eval_points_list;
 
 
 	// All additional parameters
 	// @todo Group them somehow
 	  
+	/**
+	 * The load of the homogeneous material point (see numEx::MaterialPointDriver):
+	 * The corner constraints of the rotated cube only admit the homogeneous deformations with the shear H_xy = Delta_u/(width*sqrt(2))
+	 * from the pulled top corner, the stretch H_xx is free and all other components vanish.
+	 * @note This is identical to the single element as long as the material does not create a normal stress P_yy under this load
+	 * (e.g. linear elasticity). Otherwise, the element additionally activates its non-homogeneous (bilinear) modes.
+	 * @param current_load_increment Displacement increment of the top corner in x-direction
+	 */
+	template<int dim>
+	numEx::MaterialPointLoad<dim> make_material_point_load ( const double &current_load_increment, const Parameter::GeneralParameters &parameter )
+	{
+		AssertThrow( parameter.driver == enums::Dirichlet, ExcMessage(numEx_name+"<< The material point can only be driven by Dirichlet loads."));
+
+		numEx::MaterialPointLoad<dim> load;
+		for ( unsigned int i=0; i<dim; i++ )
+			for ( unsigned int j=0; j<dim; j++ )
+				if ( i!=j || i==enums::y )
+					load.prescribe( i, j, 0 );
+		load.prescribe( enums::x, enums::y, current_load_increment/(parameter.width*std::sqrt(2)) );
+		return load;
+	}
+
 	/**
 	 * Apply the boundary conditions (support and load) on the given AffineConstraints \a constraints. \n
 	 * For the HyperCube that are three symmetry constraints on each plane (x=0, y=0, z=0) and the load on the \a id_boundary_load (for Dirichlet).
@@ -79,100 +111,74 @@ namespace Unconstrained_elastoplastic_test
 	template<int dim>
 	void make_constraints ( AffineConstraints<double> &constraints, const FESystem<dim> &fe, DoFHandler<dim> &dof_handler_ref,
 							const bool &apply_dirichlet_bc, double &current_load_increment, const Parameter::GeneralParameters &parameter,
-							const unsigned int current_load_step )
+							const unsigned int current_load_step, State &state=example_state )
 	{
 		// BC for the load ...
 		 if ( parameter.driver == enums::Dirichlet )  // ... as Dirichlet only for Dirichlet as driver, alternatively  ...
 		 {
-			 const double load_increment = apply_dirichlet_bc ? current_load_increment : 0;
-			 // First, add lines to the constraints matrix
-			 // Then, we fill all desired non-zero entries, here we fill every entry even the entries that are zero
-			  constraints.add_line(0);
-			  constraints.set_inhomogeneity(0,0);
-
-			  constraints.add_line(3);
-			  constraints.set_inhomogeneity(3,0);
-
-			  constraints.add_line(5);
-			  constraints.set_inhomogeneity(5,0);
-
-			  constraints.add_line(6);
-			  constraints.set_inhomogeneity(6,load_increment);
-
-			  constraints.add_line(7);
-			  constraints.set_inhomogeneity(7,0);
+			 // The corners of the cube rotated by 45°: bottom (0,0), right (width/sqrt(2),width/sqrt(2)), left (-width/sqrt(2),width/sqrt(2)), top (0,width*sqrt(2))
+			 // We only suppress the rigid body motions and pull the top corner in x-direction.
+			 // @todo In 3D the body is still free to move in z-direction
+			  const double width = state.body_dimensions[enums::x];
+			  Point<dim> corner_bottom, corner_right, corner_left, corner_top;
+			  corner_right[enums::x] = width/std::sqrt(2);
+			  corner_right[enums::y] = width/std::sqrt(2);
+			  corner_left[enums::x] = -width/std::sqrt(2);
+			  corner_left[enums::y] = width/std::sqrt(2);
+			  corner_top[enums::y] = width*std::sqrt(2);
+
+			 // The vertices are found once and their DoFs are cached (see \a numEx::VertexDoFCache), so this also works on refined meshes
+			  const double search_tolerance = 1e-8 * width;
+			  bool found_corners = true;
+			  found_corners &= numEx::BC_apply_at_vertex( corner_bottom, enums::x, 0, apply_dirichlet_bc, dof_handler_ref, constraints, search_tolerance );
+			  found_corners &= numEx::BC_apply_at_vertex( corner_right, enums::y, 0, apply_dirichlet_bc, dof_handler_ref, constraints, search_tolerance );
+			  found_corners &= numEx::BC_apply_at_vertex( corner_left, enums::y, 0, apply_dirichlet_bc, dof_handler_ref, constraints, search_tolerance );
+			  found_corners &= numEx::BC_apply_at_vertex( corner_top, enums::x, current_load_increment, apply_dirichlet_bc, dof_handler_ref, constraints, search_tolerance );
+			  found_corners &= numEx::BC_apply_at_vertex( corner_top, enums::y, 0, apply_dirichlet_bc, dof_handler_ref, constraints, search_tolerance );
+			  AssertThrow( found_corners || numEx::is_distributed(dof_handler_ref.get_triangulation()),
+						   ExcMessage(numEx_name+"<< Was not able to find the corners of the rotated cube. Please recheck the triangulation or adapt the code."));
 		 }
 	}
 
 	// HyperCube grid: 2D and 3D
 	template<int dim>
-	void make_grid ( Triangulation<dim> &triangulation, const Parameter::GeneralParameters &parameter )
+	void make_grid ( Triangulation<dim> &triangulation, const Parameter::GeneralParameters &parameter, State &state=example_state )
 	{
 		const double search_tolerance = parameterCollection::search_tolerance;
 
 		const double width = parameter.width;
 		
 		// Assign the characteristic dimensions of the cube
-		 body_dimensions[enums::x] = width;
-		 body_dimensions[enums::y] = width;
-		 body_dimensions[enums::z] = width;
+		 state.body_dimensions[enums::x] = width;
+		 state.body_dimensions[enums::y] = width;
+		 state.body_dimensions[enums::z] = width;
 		
 		// Set the evaluation point
-		 eval_point[enums::x] = 0;
-		 eval_point[enums::y] = width*std::sqrt(2);
-		 eval_point[enums::z] = 0;
+		 state.eval_point[enums::x] = 0;
+		 state.eval_point[enums::y] = width*std::sqrt(2);
+		 state.eval_point[enums::z] = 0;
 
 		// Set the evaluation path points
-		 eval_path_start = Point<3> (0,0,0);
-		 eval_path_start = eval_point;
+		 state.eval_path_start = Point<3> (0,0,0);
+		 state.eval_path_start = state.eval_point;
 
 		// Create the triangulation
 		 GridGenerator::hyper_cube(triangulation,0,width);
 
-		// Clear all existing boundary ID's
-		 numEx::clear_boundary_IDs( triangulation );
-		 
-		// Set the boundary IDs
-		 for ( typename Triangulation<dim>::active_cell_iterator
-			  cell = triangulation.begin_active();
-			  cell != triangulation.end(); ++cell )
-		 {
-			for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-			  if (cell->face(face)->at_boundary())
-			  {
-				if (std::abs(cell->face(face)->center()[enums::x] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_xMinus);
-				}
-				else if (std::abs(cell->face(face)->center()[enums::x] - body_dimensions[enums::x]) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_xPlus);
-				}
-				else if (std::abs(cell->face(face)->center()[enums::y] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yMinus);
-				}
-				else if (std::abs(cell->face(face)->center()[enums::y] - body_dimensions[enums::y]) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yPlus);
-				}
-				else if (dim==3 && std::abs(cell->face(face)->center()[enums::z] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_zMinus);
-				}
-				else if (dim==3 && std::abs(cell->face(face)->center()[enums::z] - body_dimensions[enums::z]) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_zPlus);
-				}
-				else
-				{
-					// There are only 6 faces for a cube in 3D, so if we missed one, something went terribly wrong
-					AssertThrow(false, ExcMessage( numEx_name+" - make_grid 3D<< Found an unidentified face at the boundary. "
-												   "Maybe it slipt through the assignment or that face is simply not needed. "
-												   "So either check the implementation or comment this line in the code") );
-				}
-			  }
-		 }
+		// Boundary IDs of the faces of the cube (before the rotation)
+		 numEx::BoundaryClassifier<dim> boundary_classifier ( search_tolerance );
+		 boundary_classifier.add_plane( enums::x, 0.0, enums::id_boundary_xMinus )
+							.add_plane( enums::x, state.body_dimensions[enums::x], enums::id_boundary_xPlus )
+							.add_plane( enums::y, 0.0, enums::id_boundary_yMinus )
+							.add_plane( enums::y, state.body_dimensions[enums::y], enums::id_boundary_yPlus );
+		 if ( dim==3 )
+			 boundary_classifier.add_plane( enums::z, 0.0, enums::id_boundary_zMinus )
+								.add_plane( enums::z, state.body_dimensions[enums::z], enums::id_boundary_zPlus );
+		 const unsigned int n_unidentified_faces = boundary_classifier.apply( triangulation );
+		// There are only 6 faces for a cube in 3D, so if we missed one, something went terribly wrong
+		 AssertThrow( n_unidentified_faces==0, ExcMessage( numEx_name+" - make_grid 3D<< Found an unidentified face at the boundary. "
+														   "Maybe it slipt through the assignment or that face is simply not needed. "
+														   "So either check the implementation or comment this line in the code") );
 
 		 // rotation by 45° = pi/4 in counter-clockwise direction
 		  const double rotation_angle_in_radian = (std::atan(1)*4.) / 4.;
@@ -182,10 +188,10 @@ namespace Unconstrained_elastoplastic_test
 		 triangulation.refine_global( parameter.nbr_global_refinements );
 
 		// Evaluation points and the related list of them
-		 numEx::EvalPointClass<3> eval_topLeftX ( eval_point, enums::x );
-		 numEx::EvalPointClass<3> eval_topLeftY ( eval_point, enums::y );
+		 numEx::EvalPointClass<3> eval_topLeftX ( state.eval_point, enums::x );
+		 numEx::EvalPointClass<3> eval_topLeftY ( state.eval_point, enums::y );
 
-		 eval_points_list = {eval_topLeftX,eval_topLeftY};
+		 state.eval_points_list = {eval_topLeftX,eval_topLeftY};
 
 		// Output the triangulation as eps or inp
 		 //numEx::output_triangulation( triangulation, enums::output_eps, numEx_name );
@@ -28,8 +28,14 @@ namespace double_edge_notched_specimen
 	 const enums::enum_boundary_ids id_boundary_load = enums::id_boundary_xMinus2;
 	 const enums::enum_boundary_ids id_boundary_secondaryLoad = enums::id_boundary_none;
 
-	// Characteristic body dimensions
-	 std::vector<double> body_dimensions (5);
+	 struct State
+	 {
+		// Characteristic body dimensions
+		 std::vector<double> body_dimensions = std::vector<double>(5);
+	 };
+	 State example_state;
+
+	 std::vector<double> &body_dimensions = example_state.body_dimensions;
 
 	// Some internal parameters
 	 struct parameterCollection
@@ -213,8 +219,8 @@ namespace double_edge_notched_specimen
 
 			 const bool notch_rounded = true;
 
-			body_dimensions[enums::x] = width;
-			body_dimensions[enums::y] = length;
+			state.body_dimensions[enums::x] = width;
+			state.body_dimensions[enums::y] = length;
 
 			parameterCollection parameters_internal;
 
@@ -228,8 +234,8 @@ namespace double_edge_notched_specimen
 			// vector containing the number of elements in each dimension
 			 std::vector<unsigned int> repetitions (3);
 			 // x-direction is coarser so the notched elements don't deteriorate to triangles
-			 repetitions[0]=body_dimensions[enums::y]/notch_length/2.; // x
-			 repetitions[1]=body_dimensions[enums::y]/notch_length; // y
+			 repetitions[0]=state.body_dimensions[enums::y]/notch_length/2.; // x
+			 repetitions[1]=state.body_dimensions[enums::y]/notch_length; // y
 
 			GridGenerator::subdivided_hyper_rectangle 	( 	triangulation,
 															repetitions,
@@ -264,12 +270,12 @@ namespace double_edge_notched_specimen
 				 Point<2> notching; // initially zero
 				// Depending on the desired notching direction (notched_face),
 				// we set the according shift component to the overall reduction
-				 notching[notched_face] = - body_dimensions[notched_face] * ( 1.-notch_reduction );
+				 notching[notched_face] = - state.body_dimensions[notched_face] * ( 1.-notch_reduction );
 
 				// A quick assurance variable to assure that at least a single vertex has been found,
 				// so our search criterion where to look for the vertices is not completely off
 				 bool found_vertex=false;
-				 double notch_location = body_dimensions[enums::y]/2.;
+				 double notch_location = state.body_dimensions[enums::y]/2.;
 
 				// Looping over all cells to notch the to-be-notched cells
 				 for ( typename Triangulation<dim>::active_cell_iterator
@@ -279,7 +285,7 @@ namespace double_edge_notched_specimen
 					for (unsigned int vertex=0; vertex < GeometryInfo<dim>::vertices_per_cell; ++vertex)
 					 // Find vertices that are in the first 1/16 of the entire length
 					  if ( std::abs(cell->vertex(vertex)[enums::y]-notch_location) <=  notch_length )
-						  if ( std::abs( cell->vertex(vertex)[notched_face] - body_dimensions[notched_face]) < search_tolerance )
+						  if ( std::abs( cell->vertex(vertex)[notched_face] - state.body_dimensions[notched_face]) < search_tolerance )
 						  {
 							  // The found vertex is moved by the \a notching vector
 							  // The notching shall be linear, hence a vertex in the notch is fully notched and the farther you
@@ -294,7 +300,7 @@ namespace double_edge_notched_specimen
 				// For compression we also notch the left edge
 				if ( notching_doubled )
 				{
-					notch_location = body_dimensions[enums::y]/2.;
+					notch_location = state.body_dimensions[enums::y]/2.;
 
 					// A quick assurance variable to assure that at least a single vertex has been found,
 					// so our search criterion where to look for the vertices is not completely off
@@ -341,16 +347,16 @@ namespace double_edge_notched_specimen
 				}
 
 				const double actual_notch_hlength = notch_length;
-				const double indent = body_dimensions[notched_face] * ( 1.-notch_reduction );
+				const double indent = state.body_dimensions[notched_face] * ( 1.-notch_reduction );
 				const double offset_of_center_from_face = (actual_notch_hlength*actual_notch_hlength - indent*indent)/(2.*indent);
 
 				// For the left radius
-				 Point<dim> centre_left_radius (-offset_of_center_from_face, body_dimensions[enums::y]/2.);
+				 Point<dim> centre_left_radius (-offset_of_center_from_face, state.body_dimensions[enums::y]/2.);
 				 static SphericalManifold<dim> spherical_manifold_left (centre_left_radius);
 				 triangulation.set_manifold(parameters_internal.manifold_id_left_radius,spherical_manifold_left);
 
 				// For the right radius
-				 Point<dim> centre_right_radius (width+offset_of_center_from_face, body_dimensions[enums::y]/2. );
+				 Point<dim> centre_right_radius (width+offset_of_center_from_face, state.body_dimensions[enums::y]/2. );
 				 static SphericalManifold<dim> spherical_manifold_right (centre_right_radius);
 				 triangulation.set_manifold(parameters_internal.manifold_id_right_radius,spherical_manifold_right);
 
@@ -370,14 +376,14 @@ namespace double_edge_notched_specimen
 					//Set boundary IDs
 					if (std::abs(cell->face(face)->center()[0] - 0.0) < search_tolerance )//&& (false || cell->face(face)->center()[enums::y] < 0.5) ) // option: not symmetric in x
 					{
-						if ( std::abs(cell->face(face)->center()[enums::y] <= body_dimensions[enums::y]/2. ) )
+						if ( std::abs(cell->face(face)->center()[enums::y] <= state.body_dimensions[enums::y]/2. ) )
 							cell->face(face)->set_boundary_id(enums::id_boundary_xMinus);
 						else
 							cell->face(face)->set_boundary_id(enums::id_boundary_xMinus2);
 					}
 					else if (std::abs(cell->face(face)->center()[0] - width) < search_tolerance)
 					{
-						if ( std::abs(cell->face(face)->center()[enums::y] <= body_dimensions[enums::y]/2. ) )
+						if ( std::abs(cell->face(face)->center()[enums::y] <= state.body_dimensions[enums::y]/2. ) )
 							cell->face(face)->set_boundary_id(enums::id_boundary_xPlus1);
 						else
 							cell->face(face)->set_boundary_id(enums::id_boundary_xPlus);
@@ -414,8 +420,8 @@ namespace double_edge_notched_specimen
 							  {
 								Point<dim> face_center = cell->face(face)->center();
 								// Find all cells that lay in an exemplary damage band with size 2xnotch_length along the diagonal
-								if (    face_center[enums::y] < (body_dimensions[enums::y]/2. + notch_length )
-									 && face_center[enums::y] > (body_dimensions[enums::y]/2. - notch_length ))
+								if (    face_center[enums::y] < (state.body_dimensions[enums::y]/2. + notch_length )
+									 && face_center[enums::y] > (state.body_dimensions[enums::y]/2. - notch_length ))
 								{
 									cell->set_refine_flag();
 									break;
@@ -480,9 +486,20 @@ namespace double_edge_notched_specimen
 
 
 
+	/**
+	 * Higher order mapping that follows the left and right notch radius with precomputed support points.
+	 * Only the 2D mesh carries these manifolds, for the 3D mesh this is a plain higher order mapping of the bricks.
+	 */
+	template<int dim>
+	const Mapping<dim> &get_mapping ( const Triangulation<dim> &triangulation, const unsigned int mapping_degree=2 )
+	{
+		return numEx::get_manifold_mapping( triangulation, mapping_degree );
+	}
+
+
 // 3d grid
 	template <int dim>
-	void make_grid( Triangulation<3> &triangulation, const Parameter::GeneralParameters &parameter )
+	void make_grid( Triangulation<3> &triangulation, const Parameter::GeneralParameters &parameter, State &state=example_state )
 	{
 		parameterCollection parameters_internal;
 
@@ -507,9 +524,9 @@ namespace double_edge_notched_specimen
 		// The notch length is set (for consistency) s.t. its mesh discretisation is exact for 1 local refinement (start)
 		 double notch_length = length/10.;//(2.*parameter.grid_y_repetitions);
 
-		body_dimensions[enums::x] = width;
-		body_dimensions[enums::y] = length;
-		body_dimensions[enums::z] = thickness;
+		state.body_dimensions[enums::x] = width;
+		state.body_dimensions[enums::y] = length;
+		state.body_dimensions[enums::z] = thickness;
 
 		// The bar is created from two bricks, where the first will be meshed very fine
 		// and the second remains coarse. The bricks are spanned by three points.
@@ -623,7 +640,7 @@ namespace double_edge_notched_specimen
 				{
 					cell->face(face)->set_boundary_id(enums::id_boundary_xMinus);
 				}
-				else if ( std::abs(cell->face(face)->center()[enums::x] - body_dimensions[enums::x] ) < search_tolerance)
+				else if ( std::abs(cell->face(face)->center()[enums::x] - state.body_dimensions[enums::x] ) < search_tolerance)
 				{
 					cell->face(face)->set_boundary_id(enums::id_boundary_xPlus);
 				}
@@ -708,7 +725,7 @@ namespace double_edge_notched_specimen
 			 Point<3> notching; // initially zero
 			// Depending on the desired notching direction (notched_face),
 			// we set the according shift component to the overall reduction
-			 notching[notched_face] = - body_dimensions[notched_face] * ( 1.-notch_reduction );
+			 notching[notched_face] = - state.body_dimensions[notched_face] * ( 1.-notch_reduction );
 
 			// A quick assurance variable to assure that at least a single vertex has been found,
 			// so our search criterion where to look for the vertices is not completely off
@@ -721,7 +738,7 @@ namespace double_edge_notched_specimen
 				for (unsigned int vertex=0; vertex < GeometryInfo<dim>::vertices_per_cell; ++vertex)
 				 // Find vertices that are in the first 1/16 of the entire length
 				  if ( std::abs(cell->vertex(vertex)[loading_direction]) <  notch_length )
-					  if ( std::abs( cell->vertex(vertex)[notched_face] - body_dimensions[notched_face]) < search_tolerance )
+					  if ( std::abs( cell->vertex(vertex)[notched_face] - state.body_dimensions[notched_face]) < search_tolerance )
 					  {
 						  // The found vertex is moved by the \a notching vector
 						  // The notching shall be linear, hence a vertex in the notch is fully notched and the farther you
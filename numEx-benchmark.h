@@ -0,0 +1,178 @@
+#ifndef NUMEX_BENCHMARK
+#define NUMEX_BENCHMARK
+
+// deal.II headers
+#include <deal.II/base/timer.h>
+#include <deal.II/base/utilities.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/lac/affine_constraints.h>
+
+// C++ headers
+#include <iostream>
+#include <string>
+#include <vector>
+#include <utility>
+#include <exception>
+#include <memory>
+
+// Numerical example helper function
+#include "./numEx-helper_fnc.h"
+#include "./numEx-registry.h"
+
+using namespace dealii;
+
+namespace numEx
+{
+	/**
+	 * Benchmark of the mesh generation and the boundary conditions of the numerical examples.
+	 * For each entry of a refinement ladder (pairs of \a nbr_global_refinements and \a nbr_holeEdge_refinements) we time the phases
+	 * - make_grid: the \a make_grid of the example,
+	 * - distribute_dofs: distribution of the DoFs of the given finite element,
+	 * - make_constraints: first call of the \a make_constraints of the example (the boundary DoFs are searched),
+	 * - make_constraints_repeat: second call, as done in every further load step and Newton iteration (cached boundary DoFs).
+	 *
+	 * Each phase is written as one JSON object per line (JSON Lines), e.g.
+	 * {"numEx":"Rod","dim":3,"nbr_global_refinements":1,"nbr_holeEdge_refinements":2,"phase":"make_grid","wall_time":0.12,
+	 *  "n_cells":1536,"cells_per_second":12800,"n_dofs":0,"peak_rss_kB":51234,"error":""}
+	 * so the results of different commits can simply be compared via scripts.
+	 * @note The peak RSS (VmHWM) is a property of the whole process and does never decrease, so the first example of a ladder with
+	 * the largest mesh dominates the following entries. Run each example in its own process to get meaningful memory numbers.
+	 * @note An exception (e.g. an example that is not implemented in 3D) is recorded in the "error" field and the ladder continues.
+	 */
+	class GridBenchmark
+	{
+	public:
+		GridBenchmark ( std::ostream &output=std::cout )
+		:
+		out(output)
+		{
+		}
+
+		/**
+		 * Run the refinement ladder for one example
+		 * @param make_grid Callable with the arguments (Triangulation<dim>&, const Parameter::GeneralParameters&)
+		 * @param make_constraints Callable with the arguments (AffineConstraints<double>&, DoFHandler<dim>&, const Parameter::GeneralParameters&),
+		 * which wraps the example-specific signature of \a make_constraints
+		 */
+		template<int dim, typename MakeGridType, typename MakeConstraintsType>
+		void run ( const std::string &numEx_name, const Parameter::GeneralParameters &parameter, const FESystem<dim> &fe,
+				   const std::vector< std::pair<unsigned int,unsigned int> > &refinement_ladder,
+				   const MakeGridType &make_grid, const MakeConstraintsType &make_constraints )
+		{
+			for ( unsigned int i=0; i<refinement_ladder.size(); i++ )
+			{
+				Parameter::GeneralParameters parameter_step = parameter;
+				parameter_step.nbr_global_refinements = refinement_ladder[i].first;
+				parameter_step.nbr_holeEdge_refinements = refinement_ladder[i].second;
+
+				Triangulation<dim> triangulation;
+				DoFHandler<dim> dof_handler ( triangulation );
+				AffineConstraints<double> constraints;
+				Timer timer;
+
+				const std::string record_head = "{\"numEx\":\"" + numEx_name + "\",\"dim\":" + std::to_string(dim)
+												+ ",\"nbr_global_refinements\":" + std::to_string(refinement_ladder[i].first)
+												+ ",\"nbr_holeEdge_refinements\":" + std::to_string(refinement_ladder[i].second);
+
+				// The first make_constraints shall always search the boundary DoFs
+				 get_boundary_dof_cache<dim>().clear();
+
+				std::string phase = "make_grid";
+				try
+				{
+					timer.restart();
+					 make_grid( triangulation, parameter_step );
+					write_record( record_head, phase, timer.wall_time(), triangulation.n_active_cells(), 0 );
+
+					phase = "distribute_dofs";
+					timer.restart();
+					 dof_handler.distribute_dofs( fe );
+					write_record( record_head, phase, timer.wall_time(), triangulation.n_active_cells(), dof_handler.n_dofs() );
+
+					phase = "make_constraints";
+					timer.restart();
+					 make_constraints( constraints, dof_handler, parameter_step );
+					write_record( record_head, phase, timer.wall_time(), triangulation.n_active_cells(), dof_handler.n_dofs() );
+
+					phase = "make_constraints_repeat";
+					constraints.clear();
+					timer.restart();
+					 make_constraints( constraints, dof_handler, parameter_step );
+					write_record( record_head, phase, timer.wall_time(), triangulation.n_active_cells(), dof_handler.n_dofs() );
+				}
+				catch ( const std::exception &exc )
+				{
+					write_record( record_head, phase, timer.wall_time(), triangulation.n_active_cells(), dof_handler.n_dofs(), exc.what() );
+				}
+			}
+		}
+
+		/**
+		 * Run the refinement ladder for all examples in the \a registry, one example after another
+		 * @param boundary_id_collection The boundary ids for the examples that expect a list of them (e.g. ThreePointBeam, TensileCompression),
+		 * see \a ConstraintsArguments
+		 */
+		template<int dim>
+		void run ( const ExampleRegistry<dim> &registry, const Parameter::GeneralParameters &parameter, const FESystem<dim> &fe,
+				   const std::vector< std::pair<unsigned int,unsigned int> > &refinement_ladder,
+				   const std::vector<unsigned int> &boundary_id_collection )
+		{
+			const std::vector<std::string> names = registry.get_names();
+			for ( unsigned int i=0; i<names.size(); i++ )
+			{
+				const std::unique_ptr<ExampleInstance<dim>> example = registry.get( names[i] ).create_instance();
+				run<dim>( names[i], parameter, fe, refinement_ladder,
+						  [&] ( Triangulation<dim> &triangulation, const Parameter::GeneralParameters &parameter_step )
+						  { example->make_grid( triangulation, parameter_step, boundary_id_collection ); },
+						  [&] ( AffineConstraints<double> &constraints, DoFHandler<dim> &dof_handler, const Parameter::GeneralParameters &parameter_step )
+						  {
+							  ConstraintsArguments<dim> arguments ( constraints, fe, dof_handler, parameter_step );
+							  arguments.boundary_id_collection = boundary_id_collection;
+							  example->make_constraints( arguments );
+						  } );
+			}
+		}
+
+		/**
+		 * Run the refinement ladder for all examples registered in 2D and then for all examples registered in 3D
+		 */
+		void run ( const ExampleRegistry<2> &registry_2d, const FESystem<2> &fe_2d,
+				   const ExampleRegistry<3> &registry_3d, const FESystem<3> &fe_3d,
+				   const Parameter::GeneralParameters &parameter, const std::vector< std::pair<unsigned int,unsigned int> > &refinement_ladder,
+				   const std::vector<unsigned int> &boundary_id_collection )
+		{
+			run<2>( registry_2d, parameter, fe_2d, refinement_ladder, boundary_id_collection );
+			run<3>( registry_3d, parameter, fe_3d, refinement_ladder, boundary_id_collection );
+		}
+
+	private:
+		void write_record ( const std::string &record_head, const std::string &phase, const double wall_time,
+							const unsigned int n_cells, const types::global_dof_index n_dofs, const std::string &error="" )
+		{
+			Utilities::System::MemoryStats memory_stats;
+			Utilities::System::get_memory_stats( memory_stats );
+
+			// Keep the error message on a single line and free of quotes, so each record stays a valid JSON line
+			 std::string error_escaped = error;
+			 for ( unsigned int c=0; c<error_escaped.size(); c++ )
+				 if ( error_escaped[c] == '"' || error_escaped[c] == '\\' || error_escaped[c] == '\n' || error_escaped[c] == '\r' || error_escaped[c] == '\t' )
+					 error_escaped[c] = ' ';
+
+			out << record_head
+				<< ",\"phase\":\"" << phase << "\""
+				<< ",\"wall_time\":" << wall_time
+				<< ",\"n_cells\":" << n_cells
+				<< ",\"cells_per_second\":" << ( wall_time > 0. ? n_cells/wall_time : 0. )
+				<< ",\"n_dofs\":" << n_dofs
+				<< ",\"peak_rss_kB\":" << memory_stats.VmHWM
+				<< ",\"error\":\"" << error_escaped << "\"}"
+				<< std::endl;
+		}
+
+		std::ostream &out;
+	};
+}
+
+#endif // NUMEX_BENCHMARK
@@ -2,9 +2,49 @@
 #define NUMEX_HELPERFNC
 
 #include <deal.II/grid/grid_out.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/manifold.h>
+#include <deal.II/grid/tria_description.h>
+#include <deal.II/distributed/fully_distributed_tria.h>
+#include <deal.II/fe/mapping_q1.h>
+#include <deal.II/fe/mapping_q_generic.h>
+#include <deal.II/fe/mapping_q_cache.h>
+#include <deal.II/base/bounding_box.h>
+#include <deal.II/numerics/rtree.h>
+#include <deal.II/base/vectorization.h>
+
+#ifdef DEAL_II_WITH_ZLIB
+#  include <zlib.h>
+#endif
+
+#include <unistd.h>
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/vector.hpp>
 
 
 #include <iostream>
+#include <fstream>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <array>
+#include <atomic>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <vector>
+#include <map>
+#include <set>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 
 namespace enums
@@ -72,7 +112,10 @@ namespace enums
 		Mesh_refine_beam_nx1 = 2,
 		Mesh_Rod_Upsetting_tapered = 10,
 		Mesh_Rod_ax_ratio_EL = 11,
-		Mesh_HyperRectangle_coarse_and_fine_brick = 12
+		Mesh_HyperRectangle_coarse_and_fine_brick = 12,
+		Mesh_refine_beam_fineCoarseBrick_minimal = 13,
+		Mesh_HyperRectangle_coarse_and_fine_brick_minimal = 14,
+		Mesh_Butterfly_coarse_and_fine_brick_minimal = 15
 	};
     
     enum enum_coord
@@ -94,7 +137,11 @@ namespace enums
    enum enum_output_type
    {
 	   output_eps = 0,
-	   output_inp = 1
+	   output_inp = 1,
+	   output_vtu = 2,		//!< binary VTU (PVTU master for distributed triangulations)
+	   output_vtu_zlib = 3,	//!< binary VTU compressed with zlib
+	   output_msh = 4,		//!< binary Gmsh
+	   output_quality = 5	//!< text report of the mesh quality (see numEx::MeshQualityReport)
    };
    
    enum enum_notch_type
@@ -120,52 +167,135 @@ namespace enums
 namespace numEx
 {
 	/**
-	 * Apply the boundary condition on the given boundary id \a boundary_id for the component \a component.
-	 * For symmetry constraints (zero displacement) we get a \load_increment of 0, so we use ZeroFunction, else we apply a ConstantFunciton.
+	 * Cache for the DoFs that are constrained by a Dirichlet BC on a boundary id for a component mask.
+	 * The examples rebuild their constraints in every load step and Newton iteration, but the constrained DoFs only change
+	 * with the mesh and the DoF distribution. Hence, we determine the boundary DoFs once via \a interpolate_boundary_values
+	 * and afterwards only add the lines and inhomogeneities to the constraints.
+	 * The cache is reset when the DoFHandler, its triangulation or the number of DoFs changed, and on every change of the triangulation
+	 * (refinement, coarsening, clear), signalled via the triangulation.
+	 * @note Renumbering the DoFs does not change the number of DoFs, so call \a clear() after renumbering.
 	 */
 	template<int dim>
-	void BC_apply ( const enums::enum_boundary_ids boundary_id, const unsigned int component, const double load_increment, const bool &apply_dirichlet_bc,
-					const DoFHandler<dim> &dof_handler,const FESystem<dim> &fe, AffineConstraints<double> &constraints )
-	{	
-		// @todo The component masks and displacement mask are HARDCODED and should depend on the order in the FESystem
-		const FEValuesExtractors::Scalar displacement_component(component);
-		const unsigned int n_components = fe.n_components();
-		
-		if (apply_dirichlet_bc == true )
+	class BoundaryDoFCache
+	{
+	public:
+		BoundaryDoFCache () = default;
+
+		~BoundaryDoFCache ()
 		{
-			// Apply the given load
-			if ( load_increment!=0 )
-			{
-				VectorTools::interpolate_boundary_values(
-															dof_handler,
-															boundary_id,
-															ConstantFunction<dim> (load_increment/*add only the increment*/, n_components),
-															constraints,
-															fe.component_mask(displacement_component)
-														);
-			}
-			// Apply zero displacement BC
-			else
+			tria_listener.disconnect();
+		}
+
+		BoundaryDoFCache ( const BoundaryDoFCache<dim> & ) = delete;
+		BoundaryDoFCache<dim> &operator= ( const BoundaryDoFCache<dim> & ) = delete;
+
+		/**
+		 * @return The DoFs on the boundary with the id \a boundary_id that belong to the components selected in \a component_mask
+		 */
+		const std::vector<types::global_dof_index> &get_boundary_dofs ( const DoFHandler<dim> &dof_handler, const types::boundary_id boundary_id,
+																		const ComponentMask &component_mask )
+		{
+			if ( outdated || &dof_handler != cached_dof_handler
+				 || &dof_handler.get_triangulation() != cached_tria || dof_handler.n_dofs() != cached_n_dofs )
+				reset( dof_handler );
+
+			// Key of the cache entry: the boundary id and the selected components (an empty mask selects all components)
+			 const unsigned int n_components = dof_handler.get_fe().n_components();
+			 std::vector<bool> selected_components ( n_components );
+			 for ( unsigned int c=0; c<n_components; c++ )
+				 selected_components[c] = component_mask[c];
+			 const std::pair< types::boundary_id, std::vector<bool> > key ( boundary_id, selected_components );
+
+			typename std::map< std::pair< types::boundary_id, std::vector<bool> >, std::vector<types::global_dof_index> >::iterator
+				entry = boundary_dofs.find(key);
+			if ( entry == boundary_dofs.end() )
 			{
-				VectorTools::interpolate_boundary_values(
-															dof_handler,
-															boundary_id,
-															ZeroFunction<dim> ( n_components ),
-															constraints,
-															fe.component_mask(displacement_component)
-														);
+				// The full boundary traversal is only done once per entry
+				 std::map<types::global_dof_index,double> boundary_values;
+				 VectorTools::interpolate_boundary_values( dof_handler, boundary_id, ZeroFunction<dim> (n_components), boundary_values, component_mask );
+
+				 std::vector<types::global_dof_index> dofs;
+				 dofs.reserve( boundary_values.size() );
+				 for ( typename std::map<types::global_dof_index,double>::const_iterator it = boundary_values.begin(); it != boundary_values.end(); ++it )
+					 dofs.push_back( it->first );
+
+				entry = boundary_dofs.insert( std::make_pair( key, dofs ) ).first;
 			}
+			return entry->second;
 		}
-		else
+
+		/**
+		 * Remove all cached DoF sets, e.g. after renumbering the DoFs
+		 */
+		void clear ()
+		{
+			outdated = true;
+		}
+
+	private:
+		void reset ( const DoFHandler<dim> &dof_handler )
 		{
-			VectorTools::interpolate_boundary_values(
-														dof_handler,
-														boundary_id,
-														ZeroFunction<dim> ( n_components ),
-														constraints,
-														fe.component_mask(displacement_component)
-													);
+			boundary_dofs.clear();
+			cached_dof_handler = &dof_handler;
+			cached_tria = &dof_handler.get_triangulation();
+			cached_n_dofs = dof_handler.n_dofs();
+
+			tria_listener.disconnect();
+			tria_listener = dof_handler.get_triangulation().signals.any_change.connect( [this] () { outdated = true; } );
+			outdated = false;
 		}
+
+		bool outdated = true;
+		const DoFHandler<dim> *cached_dof_handler = nullptr;
+		const Triangulation<dim> *cached_tria = nullptr;
+		types::global_dof_index cached_n_dofs = 0;
+		boost::signals2::connection tria_listener;
+		std::map< std::pair< types::boundary_id, std::vector<bool> >, std::vector<types::global_dof_index> > boundary_dofs;
+	};
+
+	/**
+	 * The boundary DoF cache shared by all calls of \a BC_apply and \a BC_apply_fix.
+	 * One cache per thread, so examples can build their constraints concurrently (e.g. in the \a SweepExecutor)
+	 */
+	template<int dim>
+	BoundaryDoFCache<dim> &get_boundary_dof_cache ()
+	{
+		static thread_local BoundaryDoFCache<dim> boundary_dof_cache;
+		return boundary_dof_cache;
+	}
+
+	/**
+	 * Constrain the \a dofs to the \a value, equivalent to \a interpolate_boundary_values with a constant function:
+	 * DoFs that are already constrained (e.g. by an earlier BC) keep their existing constraint.
+	 */
+	inline void BC_constrain_dofs ( const std::vector<types::global_dof_index> &dofs, const double value, AffineConstraints<double> &constraints )
+	{
+		for ( unsigned int i=0; i<dofs.size(); i++ )
+			if ( constraints.can_store_line(dofs[i]) && !constraints.is_constrained(dofs[i]) )
+			{
+				constraints.add_line( dofs[i] );
+				if ( value != 0 )
+					constraints.set_inhomogeneity( dofs[i], value );
+			}
+	}
+
+	/**
+	 * Apply the boundary condition on the given boundary id \a boundary_id for the component \a component.
+	 * For symmetry constraints (zero displacement) we get a \load_increment of 0, so we only add the lines, else we also set the inhomogeneity.
+	 * The constrained DoFs are taken from the \a BoundaryDoFCache, so only the first call for a boundary id and component traverses the boundary.
+	 */
+	template<int dim>
+	void BC_apply ( const enums::enum_boundary_ids boundary_id, const unsigned int component, const double load_increment, const bool &apply_dirichlet_bc,
+					const DoFHandler<dim> &dof_handler,const FESystem<dim> &fe, AffineConstraints<double> &constraints )
+	{	
+		// @todo The component masks and displacement mask are HARDCODED and should depend on the order in the FESystem
+		const FEValuesExtractors::Scalar displacement_component(component);
+
+		const std::vector<types::global_dof_index> &boundary_dofs
+			= get_boundary_dof_cache<dim>().get_boundary_dofs( dof_handler, boundary_id, fe.component_mask(displacement_component) );
+
+		// Apply the given load (add only the increment) or zero displacement BC
+		 BC_constrain_dofs( boundary_dofs, ( (apply_dirichlet_bc == true) ? load_increment : 0. ), constraints );
 	}
 	
 	template<int dim>
@@ -175,553 +305,3805 @@ namespace numEx
 		FEValuesExtractors::Vector displacements(0);
 		ComponentMask disp_mask = fe.component_mask (displacements);
 		
-		VectorTools::interpolate_boundary_values(
-													dof_handler,
-													boundary_id,
-													ZeroFunction<dim> (fe.n_components()),
-													constraints,
-													disp_mask // all disp components
-												);
+		// all disp components
+		 BC_constrain_dofs( get_boundary_dof_cache<dim>().get_boundary_dofs( dof_handler, boundary_id, disp_mask ), 0., constraints );
 	}
-	
 
 	/**
-	 * Shift the given points \a points of the triangulation \a tria by the vectors in \a shift
+	 * Map from the vertices of the mesh to their displacement DoFs, so Dirichlet BCs can be prescribed on vertices
+	 * (e.g. a homogeneous deformation of the entire boundary) instead of on hardcoded DoF numbers.
+	 * The map is built in a single pass over the cells and afterwards reused in every load step and Newton iteration.
+	 * As for the \a BoundaryDoFCache, it is rebuilt after the DoFHandler, its triangulation or the number of DoFs changed,
+	 * and on every change of the triangulation.
+	 * @note Renumbering the DoFs does not change the number of DoFs, so call \a clear() after renumbering.
+	 * @note The positions are the reference positions of the vertices (total Lagrangian), moving vertices afterwards is not tracked.
 	 */
 	template<int dim>
-	void shift_vertex_by_vector ( Triangulation<dim> &tria, const std::vector< Point<dim> > &points, const std::vector< Point<dim> > &shift, const std::string &numEx_name="" )
+	class VertexDoFCache
 	{
-		unsigned int shifted_node = 0;
-		const unsigned int n_points = points.size();
-		for (typename Triangulation<dim>::active_cell_iterator
-		   cell = tria.begin_active();
-		   cell != tria.end(); ++cell)
+	public:
+		VertexDoFCache () = default;
+
+		~VertexDoFCache ()
 		{
-		  for (unsigned int vertex=0; vertex<GeometryInfo<dim>::vertices_per_cell; ++vertex )
-			  for ( unsigned int i=0; i < n_points; i++)
-				  if ( cell->vertex(vertex).distance(points[i]) < 1e-12/*search_tolerance*/ )
-				  {
-					  cell->vertex(vertex) += shift[i];
-					  shifted_node += 1; // -> We have shifted at least a single node
-				  }
+			tria_listener.disconnect();
 		}
-		AssertThrow( shifted_node == n_points, ExcMessage(numEx_name+"<< Distortion, we only shifted "+std::to_string(shifted_node)+
-														  " instead of "+std::to_string(n_points)+" vertices."));
-	}
 
-	
+		VertexDoFCache ( const VertexDoFCache<dim> & ) = delete;
+		VertexDoFCache<dim> &operator= ( const VertexDoFCache<dim> & ) = delete;
+
+		/**
+		 * Update the map for the \a dof_handler if necessary.
+		 * Afterwards, the entries 0 .. n_vertices()-1 contain the vertices of the non-artificial cells.
+		 */
+		void update ( const DoFHandler<dim> &dof_handler )
+		{
+			if ( outdated || &dof_handler != cached_dof_handler
+				 || &dof_handler.get_triangulation() != cached_tria || dof_handler.n_dofs() != cached_n_dofs )
+				reset( dof_handler );
+		}
+
+		unsigned int n_vertices () const
+		{
+			return positions.size();
+		}
+
+		const Point<dim> &position ( const unsigned int entry ) const
+		{
+			return positions[entry];
+		}
+
+		bool at_boundary ( const unsigned int entry ) const
+		{
+			return boundary_flags[entry];
+		}
+
+		/**
+		 * @return The DoF of the displacement \a component at the vertex \a entry
+		 */
+		types::global_dof_index dof ( const unsigned int entry, const unsigned int component ) const
+		{
+			return displacement_dofs[entry*dim+component];
+		}
+
+		/**
+		 * @return The entry of the vertex at the \a point, or numbers::invalid_unsigned_int if there is none within the \a search_tolerance.
+		 * The result is remembered, so repeated calls for the same point (e.g. in every load step) do not search again.
+		 */
+		unsigned int find_vertex ( const Point<dim> &point, const double search_tolerance )
+		{
+			for ( unsigned int i=0; i<found_points.size(); i++ )
+				if ( found_points[i].first.distance(point) < search_tolerance )
+					return found_points[i].second;
+
+			unsigned int found_entry = numbers::invalid_unsigned_int;
+			for ( unsigned int entry=0; entry<positions.size(); entry++ )
+				if ( positions[entry].distance(point) < search_tolerance )
+				{
+					found_entry = entry;
+					break;
+				}
+			found_points.push_back( std::make_pair( point, found_entry ) );
+			return found_entry;
+		}
+
+		/**
+		 * Rebuild the map on the next call of \a update, e.g. after renumbering the DoFs
+		 */
+		void clear ()
+		{
+			outdated = true;
+		}
+
+	private:
+		void reset ( const DoFHandler<dim> &dof_handler )
+		{
+			const FiniteElement<dim> &fe = dof_handler.get_fe();
+			AssertThrow( fe.dofs_per_vertex > 0, ExcMessage("VertexDoFCache<< The finite element needs DoFs on the vertices to prescribe vertex displacements."));
+
+			const Triangulation<dim> &triangulation = dof_handler.get_triangulation();
+			positions.clear();
+			boundary_flags.clear();
+			displacement_dofs.clear();
+			found_points.clear();
+
+			// Mark the vertices on the boundary
+			 std::vector<bool> boundary_vertices ( triangulation.n_vertices(), false );
+			 for ( typename DoFHandler<dim>::active_cell_iterator
+				   cell = dof_handler.begin_active();
+				   cell != dof_handler.end(); ++cell )
+				 if ( !cell->is_artificial() && cell->at_boundary() )
+					 for ( unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face )
+						 if ( cell->face(face)->at_boundary() )
+							 for ( unsigned int v=0; v<GeometryInfo<dim>::vertices_per_face; v++ )
+								 boundary_vertices[cell->face(face)->vertex_index(v)] = true;
+
+			// Collect the displacement DoFs of each vertex once
+			 std::vector<unsigned int> vertex_entry ( triangulation.n_vertices(), numbers::invalid_unsigned_int );
+			 for ( typename DoFHandler<dim>::active_cell_iterator
+				   cell = dof_handler.begin_active();
+				   cell != dof_handler.end(); ++cell )
+			 {
+				if ( cell->is_artificial() )
+					continue;
+
+				for ( unsigned int v=0; v<GeometryInfo<dim>::vertices_per_cell; v++ )
+					if ( vertex_entry[cell->vertex_index(v)] == numbers::invalid_unsigned_int )
+					{
+						vertex_entry[cell->vertex_index(v)] = positions.size();
+						positions.push_back( cell->vertex(v) );
+						boundary_flags.push_back( boundary_vertices[cell->vertex_index(v)] );
+						displacement_dofs.resize( displacement_dofs.size()+dim, numbers::invalid_dof_index );
+						// @todo The displacements are HARDCODED as the first dim components of the FESystem (as in \a BC_apply)
+						 for ( unsigned int i=0; i<fe.dofs_per_vertex; i++ )
+						 {
+							 const unsigned int component = fe.system_to_component_index( v*fe.dofs_per_vertex + i ).first;
+							 if ( component < dim )
+								 displacement_dofs[ (positions.size()-1)*dim + component ] = cell->vertex_dof_index(v,i);
+						 }
+					}
+			 }
+
+			cached_dof_handler = &dof_handler;
+			cached_tria = &triangulation;
+			cached_n_dofs = dof_handler.n_dofs();
+
+			tria_listener.disconnect();
+			tria_listener = triangulation.signals.any_change.connect( [this] () { outdated = true; } );
+			outdated = false;
+		}
+
+		bool outdated = true;
+		const DoFHandler<dim> *cached_dof_handler = nullptr;
+		const Triangulation<dim> *cached_tria = nullptr;
+		types::global_dof_index cached_n_dofs = 0;
+		boost::signals2::connection tria_listener;
+		std::vector< Point<dim> > positions;
+		std::vector<bool> boundary_flags;
+		std::vector<types::global_dof_index> displacement_dofs;
+		std::vector< std::pair< Point<dim>, unsigned int > > found_points;
+	};
+
+	/**
+	 * The vertex DoF cache shared by all calls of \a BC_apply_homogeneous_deformation and \a BC_apply_at_vertex (one per thread)
+	 */
 	template<int dim>
-	Point<dim> extract_dim ( const Point<3> &point_3D )
+	VertexDoFCache<dim> &get_vertex_dof_cache ()
 	{
-		Point<dim> point_dim;
-		for ( unsigned int i=0; i<dim; i++)
-			point_dim[i] = point_3D[i];
-		
-		return point_dim;
+		static thread_local VertexDoFCache<dim> vertex_dof_cache;
+		return vertex_dof_cache;
 	}
-	
+
 	/**
-	 * Clear boundary ID's
+	 * Prescribe the homogeneous (affine) displacement increment u(X) = \a translation + \a displacement_gradient * X on all boundary vertices,
+	 * where X is the reference position of the vertex. This is the classical patch test: Any mesh of the body has to reproduce
+	 * the homogeneous deformation exactly, independent of the number of elements.
+	 * As in \a BC_constrain_dofs, DoFs that are already constrained keep their existing constraint.
+	 * For \a apply_dirichlet_bc = false only the lines are added (zero increment).
 	 */
 	template<int dim>
-	void clear_boundary_IDs ( Triangulation<dim> &triangulation )
+	void BC_apply_homogeneous_deformation ( const Tensor<2,dim> &displacement_gradient, const Tensor<1,dim> &translation, const bool &apply_dirichlet_bc,
+											const DoFHandler<dim> &dof_handler, AffineConstraints<double> &constraints )
 	{
-		// Iterate over each cell of the triangulation
-		for ( typename Triangulation<dim>::active_cell_iterator
-			  cell = triangulation.begin_active();
-			  cell != triangulation.end(); ++cell )
-		{
-			// Iterate over each face of this cell
-			 for (unsigned int face=0; face < GeometryInfo<dim>::faces_per_cell; ++face)
-				// Iterate only over faces that lay at the boundary
-				 if ( cell->face(face)->at_boundary() )
-					 // Set the the boundary ids to zero (standard|unassigned value)
-					  cell->face(face)->set_all_boundary_ids(0);
-		}
+		VertexDoFCache<dim> &vertex_dofs = get_vertex_dof_cache<dim>();
+		vertex_dofs.update( dof_handler );
+
+		for ( unsigned int entry=0; entry<vertex_dofs.n_vertices(); entry++ )
+			if ( vertex_dofs.at_boundary(entry) )
+			{
+				const Tensor<1,dim> displacement = translation + displacement_gradient * vertex_dofs.position(entry);
+				for ( unsigned int component=0; component<dim; component++ )
+				{
+					const types::global_dof_index dof = vertex_dofs.dof(entry,component);
+					if ( dof != numbers::invalid_dof_index && constraints.can_store_line(dof) && !constraints.is_constrained(dof) )
+					{
+						constraints.add_line( dof );
+						if ( apply_dirichlet_bc && displacement[component] != 0 )
+							constraints.set_inhomogeneity( dof, displacement[component] );
+					}
+				}
+			}
 	}
-	
+
+	/**
+	 * Prescribe the displacement increment \a load_increment in the direction \a component at the single vertex at the \a point,
+	 * e.g. to suppress the rigid body motions of a body that is otherwise unconstrained.
+	 * @return Whether the vertex was found (on distributed triangulations it might not be part of this processor)
+	 */
 	template<int dim>
-	void output_triangulation ( const Triangulation<dim> &triangulation, const unsigned int output_type=enums::output_eps, const std::string numEx_name="numEx" )
+	bool BC_apply_at_vertex ( const Point<dim> &point, const unsigned int component, const double load_increment, const bool &apply_dirichlet_bc,
+							  const DoFHandler<dim> &dof_handler, AffineConstraints<double> &constraints, const double search_tolerance=1e-12 )
 	{
-		std::cout << "numEx<< Writting triangulation to output ..." << std::endl;
-		std::ostringstream filename;
-		switch ( output_type )
+		VertexDoFCache<dim> &vertex_dofs = get_vertex_dof_cache<dim>();
+		vertex_dofs.update( dof_handler );
+
+		const unsigned int entry = vertex_dofs.find_vertex( point, search_tolerance );
+		if ( entry == numbers::invalid_unsigned_int )
+			return false;
+
+		const types::global_dof_index dof = vertex_dofs.dof(entry,component);
+		if ( dof != numbers::invalid_dof_index && constraints.can_store_line(dof) && !constraints.is_constrained(dof) )
 		{
-			case enums::output_eps:
-			{
-				filename << "grid-" << numEx_name << ".eps";
-				std::ofstream out (filename.str().c_str()); // @todo-optimize That should be simpler?!
-				GridOut grid_out;
-				grid_out.write_eps (triangulation, out);
-				break;
-			}
-			case enums::output_inp:
-			{
-				filename << "grid-" << numEx_name << ".inp";
-				std::ofstream out_ucd(filename.str().c_str());
-				GridOut grid_out;
-				GridOutFlags::Ucd ucd_flags(true,true,true);
-				grid_out.set_flags(ucd_flags);
-				grid_out.write_ucd(triangulation, out_ucd);
-				break;
-			}
-			default:
-				AssertThrow(false, ExcMessage(numEx_name+" - output_triangulation<< You choose a not implemented output type, try eps or inp instead."));
+			constraints.add_line( dof );
+			if ( apply_dirichlet_bc && load_increment != 0 )
+				constraints.set_inhomogeneity( dof, load_increment );
 		}
-		std::cout << "numEx<< ... grid written to " << filename.str().c_str() << std::endl;
+		return true;
 	}
 
-	
 	/**
-	 * Shift a layer of vertices of the triangulation at the coord position \a initial_pos to the position \a new_pos
-	 * @param direction Gives the shift direction 0(x), 1(y), 2(z)
+	 * Load step of a single homogeneous material point, the counterpart of the \a make_constraints of the one-element tests
+	 * (see \a numEx::MaterialPointDriver in numEx-material_point.h).
+	 * The components of the displacement gradient H = F - I are either prescribed with the increment \a Delta_H
+	 * or free, in which case the related component of the (first Piola-Kirchhoff) stress has to vanish.
 	 */
-	template <int dim>
-	void shift_vertex_layer( Triangulation<dim> &triangulation, double &initial_pos, double &new_pos, unsigned int direction )
+	template<int dim>
+	struct MaterialPointLoad
 	{
-		bool shifted_node = false;
-		for (typename Triangulation<dim>::active_cell_iterator
-		   cell = triangulation.begin_active();
-		   cell != triangulation.end(); ++cell)
-		{
-		  for (unsigned int vertex=0; vertex<GeometryInfo<dim>::vertices_per_cell; ++vertex )
-		  {
-			  if ( std::abs( cell->vertex(vertex)[direction] - initial_pos) < 1e-12/*search_tolerance*/ )
-			  {
-				  Point<dim> shift_vector;
-				  shift_vector[direction] = (new_pos-initial_pos);
-				  cell->vertex(vertex) += shift_vector;
-				  shifted_node = true; // -> We have shifted at least a single node
-			  }
-		  }
+		MaterialPointLoad ()
+		{
+			for ( unsigned int i=0; i<dim; i++ )
+				for ( unsigned int j=0; j<dim; j++ )
+					prescribed[i][j] = false;
 		}
-		// Ensure that we shifted at least a single node
-		 AssertThrow( shifted_node==true, ExcMessage("shift_vertex_layer<< You haven't moved a single node. Please check the selection criterion initial_pos "
-				 	 	 	 	 	 	 	 	 	 +std::to_string(initial_pos)+" vs your new_pos "+std::to_string(new_pos)+"."));
-	}
-	
-	template <int dim>
-	class BeamEnd : public Function<dim>
+
+		/**
+		 * Prescribe the increment \a increment of the component H_ij
+		 */
+		void prescribe ( const unsigned int i, const unsigned int j, const double increment )
+		{
+			prescribed[i][j] = true;
+			Delta_H[i][j] = increment;
+		}
+
+		Tensor<2,dim> Delta_H;
+		bool prescribed[dim][dim];
+	};
+
+	/**
+	 * Load path as a continuous function of the pseudo-time t, split into stages (e.g. tension followed by shear).
+	 * Each stage has its own load function of the time since the start of the stage, so the stages can describe different
+	 * quantities (a displacement, an angle, ...). The example decides via \a stage(*) which boundary condition the load belongs to.
+	 * A load step (t_last,t] always lies within a single stage (see \a LoadStepScheduler), a time on the boundary between two stages
+	 * belongs to the earlier one. The last stage continues beyond the \a end_time, e.g. for an open number of fixed load steps.
+	 */
+	class LoadPath
 	{
 	public:
-		BeamEnd ( const double &length0, const double &height0, const double &lambda_n, const double &current_load_increment, const unsigned int &n_components )
-		:
-			l_0(length0),
-			h_0(height0),
-			theta_n(lambda_n),
-			incr(current_load_increment),
-			n_comp(n_components)
+		/**
+		 * Append a stage of the length \a duration in pseudo-time with the \a load as function of the time since the start of the stage
+		 */
+		LoadPath &add_stage ( const double duration, const std::function<double(const double)> &load )
 		{
+			AssertThrow( duration > 0, ExcMessage("LoadPath<< The duration of a stage has to be positive."));
+			stage_ends.push_back( end_time() + duration );
+			stage_loads.push_back( load );
+			return *this;
 		}
-		virtual ~BeamEnd() {};
 
-		double l_0, h_0;
-		double theta_n;
-		double incr;
-		unsigned int n_comp;
+		/**
+		 * Linear ramp with the \a rate, e.g. the fixed load steps of constant size
+		 */
+		LoadPath &add_ramp ( const double duration, const double rate, const double start_value=0. )
+		{
+			return add_stage( duration, [rate,start_value] ( const double time ) { return start_value + rate * time; } );
+		}
 
+		/**
+		 * Triangular cycles between -\a amplitude and +\a amplitude starting at zero, each cycle takes the \a period
+		 */
+		LoadPath &add_cycles ( const unsigned int n_cycles, const double amplitude, const double period )
+		{
+			return add_stage( n_cycles*period, [amplitude,period] ( const double time )
+											   {
+												   const double phase = time/period - std::floor(time/period);
+												   if ( phase < 0.25 )
+													   return 4. * amplitude * phase;
+												   else if ( phase < 0.75 )
+													   return amplitude * ( 2. - 4. * phase );
+												   else
+													   return amplitude * ( 4. * phase - 4. );
+											   } );
+		}
 
-		// return all components at one point
-		virtual void vector_value(const Point<dim> &p, Vector<double>   &value) const
+		unsigned int n_stages () const
 		{
-			Tensor<1,dim> u_m_n;
-			u_m_n[enums::x] = l_0 * ( std::sin(theta_n+1e-10)/(theta_n+1e-10) - 1.);
-			u_m_n[enums::y] = l_0 * ( std::cos(theta_n+1e-10)/(theta_n+1e-10) - 1./(theta_n+1e-10));
+			return stage_ends.size();
+		}
 
-			const double theta_n1 = theta_n + incr;
-			Tensor<1,dim> u_m_n1;
-			u_m_n1[enums::x] = l_0 * ( std::sin(theta_n1+1e-10)/(theta_n1+1e-10) - 1.);
-			u_m_n1[enums::y] = l_0 * ( std::cos(theta_n1+1e-10)/(theta_n1+1e-10) - 1./(theta_n1+1e-10));
+		double end_time () const
+		{
+			return ( stage_ends.empty() ? 0. : stage_ends.back() );
+		}
 
-			Tensor<1,dim> u_n;
-			u_n[enums::x] = 0 						+ u_m_n[enums::x] + (p[enums::y]-h_0/2.) * std::sin(theta_n);
-			u_n[enums::y] = -(p[enums::y]-h_0/2.) 	+ u_m_n[enums::y] + (p[enums::y]-h_0/2.) * std::cos(theta_n);
+		double stage_start ( const unsigned int stage ) const
+		{
+			return ( stage==0 ? 0. : stage_ends[stage-1] );
+		}
 
-			Tensor<1,dim> u_n1;
-			u_n1[enums::x] = 0 						+ u_m_n1[enums::x] + (p[enums::y]-h_0/2.) * std::sin(theta_n1);
-			u_n1[enums::y] = -(p[enums::y]-h_0/2.)	+ u_m_n1[enums::y] + (p[enums::y]-h_0/2.) * std::cos(theta_n1);
+		double stage_end ( const unsigned int stage ) const
+		{
+			return stage_ends[stage];
+		}
 
-			for ( unsigned int i=0; i<dim; i++)
-				value[i] = u_n1[i] - u_n[i];
+		/**
+		 * @return The end of the stage in which a load step starting at \a time lies
+		 */
+		double next_stage_end ( const double time ) const
+		{
+			const std::vector<double>::const_iterator end = std::upper_bound( stage_ends.begin(), stage_ends.end(), time + time_tolerance() );
+			return ( end==stage_ends.end() ? end_time() : *end );
 		}
 
-//		virtual double value (const Point<dim>   &p,
-//							const unsigned int   = 0) const override final
-//		{
-//			double val = 1.;
-//			SymmetricTensor<2,2> stress_tensor_dummy;
-//			Point<dim> point_xy = p;
-//			get_KIRSCH_stresses( point_xy, current_load, nu, stress_tensor_dummy, val);// 0929 stress_vonMises );
-//			return val;
-//		}
-	};
+		/**
+		 * @return The stage that contains the \a time (the earlier stage for a time on the boundary between two stages)
+		 */
+		unsigned int stage ( const double time ) const
+		{
+			AssertThrow( n_stages() > 0, ExcMessage("LoadPath<< The load path does not contain any stage."));
+			const unsigned int stage = std::lower_bound( stage_ends.begin(), stage_ends.end(), time - time_tolerance() ) - stage_ends.begin();
+			return std::min( stage, n_stages()-1 );
+		}
+
+		/**
+		 * The load at the \a time evaluated in the stage \a stage (by default the stage containing the \a time)
+		 */
+		double value ( const double time, const unsigned int stage=numbers::invalid_unsigned_int ) const
+		{
+			const unsigned int s = ( stage==numbers::invalid_unsigned_int ? this->stage(time) : stage );
+			return stage_loads[s]( time - stage_start(s) );
+		}
+
+		/**
+		 * The load increment of the load step (time_last,time], which has to lie within one stage.
+		 * The first stage is extrapolated to negative times, so fixed load steps counted from zero, i.e. (-1,0], (0,1], ...,
+		 * get the same increment in every step.
+		 */
+		double increment ( const double time_last, const double time ) const
+		{
+			const unsigned int s = stage(time);
+			if ( s==0 )
+				return value( time, s ) - value( time_last, s );
+
+			AssertThrow( time_last >= stage_start(s) - time_tolerance(), ExcMessage("LoadPath<< The load step crosses the boundary of a stage."));
+			return value( time, s ) - value( std::max( time_last, stage_start(s) ), s );
+		}
+
+		/**
+		 * Tolerance for the comparison of pseudo-times, relative to the length of the load path
+		 */
+		double time_tolerance () const
+		{
+			return 1e-12 * std::max( 1., end_time() );
+		}
 
+	private:
+		std::vector<double> stage_ends;
+		std::vector< std::function<double(const double)> > stage_loads;
+	};
 
 	/**
-	 * @todo-optimize Use deal.II object information to get normal and tangent for the face
+	 * Adaptive load stepping along a \a LoadPath.
+	 * The step size is increased when the Newton iteration converged in less than the \a target_iterations and decreased for more iterations,
+	 * a diverged step is cut back. The steps end exactly on the boundaries between the stages of the load path.
+	 * The scheduler keeps its own copy of the load path, so it can also be constructed from a temporary, e.g. HyperCube_shear::get_load_path(*).
+	 * Typical use:
+	 * @code
+	 * numEx::LoadStepScheduler scheduler ( load_path, initial_step, minimal_step, maximal_step );
+	 * while ( !scheduler.finished() )
+	 * {
+	 * 	 scheduler.propose_step();
+	 * 	 // solve for the load step (scheduler.get_time_last(), scheduler.get_time()], e.g. with load_path.increment(*)
+	 * 	 if ( converged )
+	 * 		 scheduler.accept( n_newton_iterations );
+	 * 	 else
+	 * 		 scheduler.reject();
+	 * }
+	 * @endcode
 	 */
-	template <int dim>
-	class NotchClass
+	class LoadStepScheduler
 	{
 	public:
-		// Linear notch
-		NotchClass ( const unsigned int notch_type, const double &notch_length, const double &notch_depth, const Point<3> &notch_reference_point, 
-					 const types::boundary_id &notch_face_BID, const Point<3> &face_normal_vector, const unsigned int notch_tangent_dir )
+		LoadStepScheduler ( const LoadPath &load_path, const double initial_step, const double minimal_step, const double maximal_step,
+							const unsigned int target_iterations=6, const double cut_back_factor=0.25, const double maximal_growth_factor=2. )
 		:
-		type(notch_type),
-		length(notch_length),
-		depth(notch_depth),
-		ref_pos(notch_reference_point),
-		face_BID(notch_face_BID),
-		normal_vector(face_normal_vector),
-		tangent_dir(notch_tangent_dir)
+		path(load_path),
+		step_size(initial_step),
+		min_step(minimal_step),
+		max_step(maximal_step),
+		n_target(target_iterations),
+		cut_back(cut_back_factor),
+		max_growth(maximal_growth_factor)
 		{
+			AssertThrow( minimal_step > 0 && minimal_step <= initial_step && initial_step <= maximal_step,
+						 ExcMessage("LoadStepScheduler<< The step sizes have to satisfy 0 < minimal_step <= initial_step <= maximal_step."));
+			AssertThrow( cut_back_factor > 0 && cut_back_factor < 1, ExcMessage("LoadStepScheduler<< The cut back factor has to be in (0,1)."));
 		}
-		
-		// Round notch
-		NotchClass ( const unsigned int notch_type, const double &notch_length, const double &notch_depth, const Point<3> &notch_reference_point,
-					 const types::boundary_id &notch_face_BID, const Point<3> &face_normal_vector, const unsigned int notch_tangent_dir,
-					 const types::manifold_id &notch_manifold_id )
-		:
-		type(notch_type),
-		length(notch_length),
-		depth(notch_depth),
-		ref_pos(notch_reference_point),
-		face_BID(notch_face_BID),
-		normal_vector(face_normal_vector),
-		tangent_dir(notch_tangent_dir),
-		manifold_id(notch_manifold_id)
+
+		bool finished () const
 		{
-			 radius = ( std::pow(notch_length/2.,2) + notch_depth*notch_depth ) / ( 2. * notch_depth );
-			 cyl_center = notch_reference_point;
-			 cyl_center += face_normal_vector * (radius - notch_depth);
+			return ( time >= path.end_time() - path.time_tolerance() );
 		}
-		
-		// @todo Maybe also some constructors and functions in case we get the center point, etc.
-		
-		unsigned int type;
-		double length;
-		double depth;
-		Point<3> ref_pos;
-		types::boundary_id face_BID;
-		Point<3> normal_vector;
-		unsigned int tangent_dir;
-		double radius = 0.;
-		types::manifold_id manifold_id;
-		Point<3> cyl_center;
-	};
-	
-	double get_current_notch_radius( const unsigned int notch_type, double &y_coord, const double &half_notch_length, const double &radius, const double &notch_radius, const double &R  )
-	{
-		switch ( notch_type )
+
+		/**
+		 * Set the end of the next load step, limited by the end of the current stage
+		 * @return The end of the load step \a get_time()
+		 */
+		double propose_step ()
 		{
-			case enums::notch_round:
-				return R + notch_radius - std::sqrt( R*R - y_coord*y_coord );
-			case enums::notch_linear:
-				return y_coord/half_notch_length * (radius-notch_radius) + notch_radius;
-			default:
-				AssertThrow(false, ExcMessage("numEx - << notch type not implemented"));
-				return 0;
+			AssertThrow( !finished(), ExcMessage("LoadStepScheduler<< The end of the load path has already been reached."));
+			const double stage_end = path.next_stage_end( time );
+			time_next = std::min( time + step_size, stage_end );
+			// Avoid a tiny remainder in front of the end of the stage
+			 if ( stage_end - time_next < 0.1 * min_step )
+				 time_next = stage_end;
+			return time_next;
 		}
-	}
-	
-	template<int dim>
-	double get_notching ( const NotchClass<dim> &notch, const double &delta_y )
-	{
-		switch ( notch.type )
+
+		/**
+		 * Accept the proposed load step, which converged in \a n_iterations Newton iterations, and adapt the step size
+		 */
+		void accept ( const unsigned int n_iterations )
 		{
-			case enums::notch_round:
-				return std::sqrt( notch.radius*notch.radius - delta_y*delta_y ) - ( notch.radius - notch.depth );
-			case enums::notch_linear:
-				return notch.depth * ( 1. - delta_y / (notch.length/2.) );
-			default:
-				AssertThrow(false, ExcMessage("numEx - get_notching<< notch type not implemented"));
-				return 0;
+			time = time_next;
+			n_accepted++;
+
+			const double factor = std::sqrt( double(n_target) / double( std::max(n_iterations,1u) ) );
+			step_size = std::max( min_step, std::min( max_step, step_size * std::min( factor, max_growth ) ) );
 		}
-	}
 
-	
-	template<int dim>
-	void notch_body ( Triangulation<dim> &triangulation, const NotchClass<dim> &notch )
-	{
-		if ( /*soft notch*/true )
+		/**
+		 * Reject the proposed load step, e.g. after the Newton iteration diverged, and cut back the step size
+		 */
+		void reject ()
 		{
-			std::vector<unsigned int> index_list;
+			n_rejected++;
+			AssertThrow( step_size > min_step, ExcMessage("LoadStepScheduler<< The load step diverged with the minimal step size "
+														  +std::to_string(min_step)+" at the pseudo-time "+std::to_string(time)+"."));
+			step_size = std::max( min_step, std::min( step_size, time_next-time ) * cut_back );
+		}
 
-			// Generate the notch:
-			// @note The following is far from trivial, because
-			 for (typename Triangulation<dim>::active_cell_iterator
-			   cell = triangulation.begin_active();
-			   cell != triangulation.end(); ++cell)
-			 {
-				  for (unsigned int face=0; face < GeometryInfo<dim>::faces_per_cell; ++face)
-					  if ( cell->face(face)->at_boundary() && cell->face(face)->boundary_id()==notch.face_BID )
-						  for (unsigned int vertex=0; vertex < GeometryInfo<dim>::vertices_per_face; ++vertex)
-						  {
-							  // Distance from the given vertex to the reference point \a POS of the notch. We can directly
-							  // use the absolute value because the notch is symmetric
-							   double distance_vertex2POS = std::abs( cell->face(face)->vertex(vertex)[notch.tangent_dir] - notch.ref_pos[notch.tangent_dir] );
-							  // We can use "less than" without equal, because we woud do nothing for the corner points anyway.
-							  // This might also avoid spreading of the manifold to an outer cell's face.
-							   if ( distance_vertex2POS < notch.length/2. )
-							   {
-								  unsigned int index_vertex = cell->face(face)->vertex_index(vertex);
-								  if ( std::find(index_list.begin(), index_list.end(), index_vertex) == index_list.end())
-								  {
-									  // Compute the absolute value we need to move the vertex inside
-									   double notching = get_notching( notch, distance_vertex2POS );
-
-									  // Shift the vertex inwards via the negative normal vector of the face
-									   cell->face(face)->vertex(vertex) -= notching * extract_dim<dim>( notch.normal_vector );
-									   
-									  // Add the current vertex to the list of already shifted vertices
-									   index_list.push_back(index_vertex);
-								  } // end if(vertex not already shifted)
-								  
-								  // Assign cylindrical manifold for round notches. I guess we also have to do this
-								  // even if we don't shift the vertex at hand, because it is possible that we already
-								  // shifted the same vertex but from the neighbouring cell, but still need this cell's face to have
-								  // the correct manifold id.
-								   if ( notch.type == enums::notch_round )
-										cell->face(face)->set_all_manifold_ids(notch.manifold_id);
-							   } // end if(to be shifted)
-						  } // end for(vertex)
-			 } // end for(cell)
+		const LoadPath &get_load_path () const
+		{
+			return path;
+		}
+
+		/**
+		 * @return The start of the current load step (the time of the last accepted step)
+		 */
+		double get_time_last () const
+		{
+			return time;
+		}
+
+		/**
+		 * @return The end of the current load step
+		 */
+		double get_time () const
+		{
+			return time_next;
+		}
+
+		double get_step_size () const
+		{
+			return step_size;
+		}
+
+		unsigned int n_accepted_steps () const
+		{
+			return n_accepted;
+		}
+
+		unsigned int n_rejected_steps () const
+		{
+			return n_rejected;
 		}
-	}
 
+	private:
+		const LoadPath path;
+		double time = 0.;
+		double time_next = 0.;
+		double step_size;
+		const double min_step;
+		const double max_step;
+		const unsigned int n_target;
+		const double cut_back;
+		const double max_growth;
+		unsigned int n_accepted = 0;
+		unsigned int n_rejected = 0;
+	};
 	
+
 	/**
-	 * @todo Think about using this fnc only for 2D and then using extrude_triangulation
+	 * Spatial index over the unique vertices of a triangulation, keyed on the global \a vertex_index.
+	 * The vertices are sorted into a uniform hash grid, so finding the vertex at (or closest to) a given point only requires
+	 * a look into the neighbouring bins instead of a loop over all vertices of all cells.
+	 * Additionally, we store for each used vertex one active cell that contains it, which gives us write access to
+	 * the vertex via its index (deal.II only offers the vertices of the triangulation as const).
+	 * The index connects to the signals of the triangulation and is rebuilt automatically on the next query after
+	 * the triangulation changed (refinement, coarsening, clear), so it can be kept alive for the entire mesh generation.
+	 * @note Moving vertices does not trigger any signal of the triangulation. Vertices moved by \a transform_vertices
+	 * are re-sorted into the bins automatically. If you move vertices directly via \a vertex(*), call \a update_bin afterwards.
 	 */
 	template<int dim>
-	void prepare_tria_for_notching ( Triangulation<dim> &triangulation, const NotchClass<dim> &notch )
+	class VertexIndex
 	{
-		// First, we compute the corner points
-		 Point<dim> point_corner_positive = extract_dim<dim>( notch.ref_pos ); 
-		 point_corner_positive[notch.tangent_dir] += notch.length / 2.;
-		
-		 Point<dim> point_corner_negative = extract_dim<dim>( notch.ref_pos ); 
-		 point_corner_negative[notch.tangent_dir] -= notch.length / 2.;
-		 
-		 // The point at the reference point shall be shifted into the body, so we look for
-		 // vertex at this point.
-		 Point<dim> point_corner_depth = extract_dim<dim>( notch.ref_pos );
+	public:
+		VertexIndex ( Triangulation<dim> &triangulation, const bool only_boundary_vertices=false )
+		:
+		tria(&triangulation),
+		boundary_only(only_boundary_vertices)
+		{
+			tria_listener = tria->signals.any_change.connect( [this] () { outdated = true; } );
+			build();
+		}
 
-		// Then, we find the nearest vertex and adapt them to the corner points either locally or globally
-		// We limit the list of vertices only to the vertices at the boundary to reduce the number of vertices
-		// to be tested and to avoid finding vertices inside the body.
-		 const unsigned int vertexID_closest_positive = GridTools::find_closest_vertex( GridTools::get_all_vertices_at_boundary(triangulation), point_corner_positive );
-		 const unsigned int vertexID_closest_negative = GridTools::find_closest_vertex( GridTools::get_all_vertices_at_boundary(triangulation), point_corner_negative );
-		 const unsigned int vertexID_closest_depth = 	GridTools::find_closest_vertex( GridTools::get_all_vertices_at_boundary(triangulation), point_corner_depth );
+		~VertexIndex ()
+		{
+			tria_listener.disconnect();
+		}
 
-		switch ( notch.type )
+		VertexIndex ( const VertexIndex<dim> & ) = delete;
+		VertexIndex<dim> &operator= ( const VertexIndex<dim> & ) = delete;
+
+		/**
+		 * Rebuild the index if the triangulation changed since the last \a build
+		 */
+		void update ()
 		{
-			case enums::notch_round:
-				if ( vertexID_closest_positive == vertexID_closest_negative )
-					AssertThrow( false, ExcMessage( "prepare_tria_for_notching<< The two found points closest to the corner points of the notch are identical, "
-													"but need to be different. Use a finer mesh.") );
-				break;
-			case enums::notch_linear:
-				if ( vertexID_closest_positive == vertexID_closest_negative 
-					||  vertexID_closest_depth == vertexID_closest_negative
-					||  vertexID_closest_positive == vertexID_closest_depth )
-					AssertThrow( false, ExcMessage( "prepare_tria_for_notching<< The three found points closest to the corner points of the notch coincident "
-													"partly or fully, but need to be different. Use a finer mesh.") );
-				break;
+			if ( outdated )
+				build();
 		}
 
-		// @todo-extent The following limits the orientations of the notch to the xy-plane
-		// Find the coordinates of the closest vertex.
-		 Point<dim> vertex_closest_positive, vertex_closest_negative, vertex_closest_depth;
-		 for (typename Triangulation<dim>::active_cell_iterator
-		   cell = triangulation.begin_active();
-		   cell != triangulation.end(); ++cell)
-		 {
-			  for (unsigned int vertex=0; vertex < GeometryInfo<dim>::vertices_per_cell; ++vertex)
-			  {
-				   unsigned int index_vertex = cell->vertex_index(vertex);
-				   // @todo We should also check whether the point is reasonably far away.
-				   if ( index_vertex == vertexID_closest_positive )
-				   {
-					   for ( unsigned int i=0; i<dim; i++ )
-						   vertex_closest_positive[i] = cell->vertex(vertex)[i];
-				   }
-				   else if ( index_vertex == vertexID_closest_negative )
-				   {
-					   for ( unsigned int i=0; i<dim; i++ )
-						   vertex_closest_negative[i] = cell->vertex(vertex)[i];
-				   }
-				   else if (notch.type==enums::notch_linear && index_vertex == vertexID_closest_depth )
-				   {
-					   for ( unsigned int i=0; i<dim; i++ )
-						   vertex_closest_depth[i] = cell->vertex(vertex)[i];
-				   }
-			  }
-		 }
-		 
-		// Loop over each vertex to find the above two and also the ones in the third dimension and shift them
-		// @todo-optimize There should be a simpler way to find the vertex, when we know its index
-		 for (typename Triangulation<dim>::active_cell_iterator
-		   cell = triangulation.begin_active();
-		   cell != triangulation.end(); ++cell)
-		 {
-			  for (unsigned int vertex=0; vertex<GeometryInfo<dim>::vertices_per_cell; ++vertex)
-			  {
-				  Point<dim> vector_to_positive = cell->vertex(vertex);
-				  vector_to_positive -= vertex_closest_positive;
-				  double distance2D_to_positive = std::sqrt( vector_to_positive[0]*vector_to_positive[0] + vector_to_positive[1]*vector_to_positive[1] );
-				  Point<dim> vector_to_negative = cell->vertex(vertex);
-				  vector_to_negative -= vertex_closest_negative;
-				  double distance2D_to_negative = std::sqrt( vector_to_negative[0]*vector_to_negative[0] + vector_to_negative[1]*vector_to_negative[1] );
-				  Point<dim> vector_to_depth = cell->vertex(vertex);
-				  vector_to_depth -= vertex_closest_depth;
-				  double distance2D_to_depth = std::sqrt( vector_to_depth[0]*vector_to_depth[0] + vector_to_depth[1]*vector_to_depth[1] );
-				  
-				   if ( distance2D_to_positive < 1e-8 )
-				   {
-					   cell->vertex(vertex)[0] = point_corner_positive[0];
-					   cell->vertex(vertex)[1] = point_corner_positive[1];
-				   }
-				   else if ( distance2D_to_negative < 1e-8 )
-				   {
-					   cell->vertex(vertex)[0] = point_corner_negative[0];
-					   cell->vertex(vertex)[1] = point_corner_negative[1];
-				   }
-				   else if ( notch.type==enums::notch_linear && distance2D_to_depth < 1e-8 )
-				   {
-					   cell->vertex(vertex)[0] = point_corner_depth[0];
-					   cell->vertex(vertex)[1] = point_corner_depth[1];
-				   }
-			  }
-		 }
-	}
-	
-	
-	/**
-	 * @todo Use spherical manifold or sth on coarse mesh and only move a single node in, then do local refinements and all vertices will follow the curvature
-	 * @param triangulation
-	 * @param half_notch_length Half the length of the notch in y-direction. We only model 1/8 of the entire bar, hence only 1/2 of the notch length
-	 * @param notch_radius The radius of the rod that is left at y=0 in the notch
-	 * @param R The radius of the notch corresponds to the tool radius that could be used on a lathe to create the notch.
-	 */
-	template <int dim>
-	void notch_body( Triangulation<dim> &triangulation, const double &half_notch_length, const double &radius, const double &notch_radius,
-					 const double &R, const unsigned int notch_type, const bool geom_cylindrical=false, const double offset=0. )
-	{
-		enum enum_coord_directions
+		/**
+		 * Find the vertex that lies within the \a tolerance around the \a point
+		 * @return The global vertex index or numbers::invalid_unsigned_int if no vertex was found
+		 */
+		unsigned int find_vertex ( const Point<dim> &point, const double tolerance=1e-12 )
 		{
-			x = 0, y = 1, z = 2
+			update();
+			Assert( tolerance < bin_size, ExcMessage("VertexIndex<< The search tolerance exceeds the bin size of the index."));
+
+			unsigned int index_closest = numbers::invalid_unsigned_int;
+			double distance_closest = tolerance;
+			// The point might lie close to a bin border, so we also look into the direct neighbours (first ring)
+			 search_ring( get_bin_key(point), 0, point, index_closest, distance_closest );
+			 search_ring( get_bin_key(point), 1, point, index_closest, distance_closest );
+			return index_closest;
+		}
+
+		/**
+		 * Find the indexed vertex closest to the \a point.
+		 * We search the bins in rings of growing size around the bin of the \a point and stop as soon as
+		 * no vertex in the next ring can be closer than the closest vertex found so far.
+		 * @return The global vertex index or numbers::invalid_unsigned_int if the index is empty
+		 */
+		unsigned int find_closest_vertex ( const Point<dim> &point )
+		{
+			update();
+			const std::array<long,dim> key = get_bin_key( point );
+
+			// The largest ring that still touches an occupied bin
+			 long max_ring = 0;
+			 for ( unsigned int i=0; i<dim; i++ )
+				 max_ring = std::max( max_ring, std::max( std::abs(key[i]-key_min[i]), std::abs(key_max[i]-key[i]) ) );
+
+			unsigned int index_closest = numbers::invalid_unsigned_int;
+			double distance_closest = std::numeric_limits<double>::max();
+			for ( long ring=0; ring<=max_ring; ring++ )
+			{
+				search_ring( key, ring, point, index_closest, distance_closest );
+				// Any vertex in the following rings is at least \a ring bins away
+				 if ( index_closest != numbers::invalid_unsigned_int && distance_closest <= ring * bin_size )
+					 break;
+			}
+			return index_closest;
+		}
+
+		/**
+		 * Write access to the vertex with the global index \a index_vertex
+		 */
+		Point<dim> &vertex ( const unsigned int index_vertex )
+		{
+			update();
+			Assert( vertex_in_cell[index_vertex] != numbers::invalid_unsigned_int,
+					ExcMessage("VertexIndex<< The vertex "+std::to_string(index_vertex)+" is not used by any active cell."));
+			return vertex_cells[index_vertex]->vertex( vertex_in_cell[index_vertex] );
+		}
+
+		/**
+		 * One active cell that contains the vertex with the global index \a index_vertex
+		 */
+		typename Triangulation<dim>::active_cell_iterator cell ( const unsigned int index_vertex )
+		{
+			update();
+			return vertex_cells[index_vertex];
+		}
+
+		/**
+		 * The global indices of all vertices that were sorted into the bins
+		 */
+		const std::vector<unsigned int> &get_indexed_vertices ()
+		{
+			update();
+			return indexed_vertices;
+		}
+
+		/**
+		 * Sort the vertex \a index_vertex into the bin of its current position (after it was moved)
+		 */
+		void update_bin ( const unsigned int index_vertex )
+		{
+			if ( outdated || indexed[index_vertex]==false )
+				return;
+
+			const std::array<long,dim> key_new = get_bin_key( tria->get_vertices()[index_vertex] );
+			if ( key_new == vertex_keys[index_vertex] )
+				return;
+
+			std::vector<unsigned int> &bin_old = bins[ vertex_keys[index_vertex] ];
+			bin_old.erase( std::find( bin_old.begin(), bin_old.end(), index_vertex ) );
+			insert_into_bin( index_vertex, key_new );
+		}
+
+	private:
+		struct BinKeyHash
+		{
+			std::size_t operator() ( const std::array<long,dim> &key ) const
+			{
+				std::size_t hash = 0;
+				for ( unsigned int i=0; i<dim; i++ )
+					hash = hash * 1000003 ^ std::hash<long>()( key[i] );
+				return hash;
+			}
 		};
-		const double search_tolerance = 1e-12;
 
-		if ( /*Deep notch: also adapt inner nodes in the notched area*/true )
+		/**
+		 * Build the index for the current state of the triangulation
+		 */
+		void build ()
 		{
-			// ToDo-optimize: Do we need the \a index_list anymore? (compare shallow notch below)
-			std::vector<unsigned int> index_list;
+			const unsigned int n_vertices = tria->n_vertices();
+			vertex_cells.assign( n_vertices, typename Triangulation<dim>::active_cell_iterator() );
+			vertex_in_cell.assign( n_vertices, numbers::invalid_unsigned_int );
+			indexed.assign( n_vertices, false );
+			vertex_keys.assign( n_vertices, std::array<long,dim>() );
+			bins.clear();
+			indexed_vertices.clear();
 
-			// Generate the notch
+			// Find for each unique vertex the first active cell that contains it (one pass over all cells)
 			 for (typename Triangulation<dim>::active_cell_iterator
-			   cell = triangulation.begin_active();
-			   cell != triangulation.end(); ++cell)
+				  cell = tria->begin_active();
+				  cell != tria->end(); ++cell)
 			 {
-				  for (unsigned int vertex=0; vertex<GeometryInfo<dim>::vertices_per_cell; ++vertex)
+				  for (unsigned int vertex=0; vertex < GeometryInfo<dim>::vertices_per_cell; ++vertex )
 				  {
-					  // We look for all the points that lie in the notched area (y-coord in half length of notch)
-					   double y_coord = std::abs( offset - cell->vertex(vertex)[y] );
-					   unsigned int index_vertex = cell->vertex_index(vertex);
-					   if ( y_coord < half_notch_length && (std::find(index_list.begin(), index_list.end(), index_vertex) == index_list.end()) )
-					   {
-						  double x_coord = cell->vertex(vertex)[x];
-						  double vertex_radius, z_coord;
-						  if ( dim==2 || ( dim==3 && geom_cylindrical==false ) )
-							  vertex_radius=x_coord;
-						  else if ( dim==3 && geom_cylindrical )
+					  const unsigned int index_vertex = cell->vertex_index(vertex);
+					  if ( vertex_in_cell[index_vertex] == numbers::invalid_unsigned_int )
+					  {
+						  vertex_cells[index_vertex] = cell;
+						  vertex_in_cell[index_vertex] = vertex;
+						  if ( boundary_only==false )
 						  {
-							  z_coord = cell->vertex(vertex)[z];
-							  vertex_radius = std::sqrt(x_coord*x_coord + z_coord*z_coord);
+							  indexed[index_vertex] = true;
+							  indexed_vertices.push_back(index_vertex);
 						  }
-							  
-						  // The radius of the leftover notched material describes an arc along the y-coord.
-						  // Hence, the radius of the notch changes with the y-coord
-						   double current_notch_radius = get_current_notch_radius( notch_type, y_coord, half_notch_length, radius, notch_radius, R );
-						  // Set the shift vector that moves the vertex inwards (along its radius)
-						   Point<dim> shift_vector;
-						   shift_vector[x] = (current_notch_radius - radius) * std::sqrt(vertex_radius/radius) * x_coord/radius;
-						   if ( dim==3 )
-							   shift_vector[z] = (current_notch_radius - radius) * std::sqrt(vertex_radius/radius) * z_coord/radius;
-						  // Apply the shift vector to the vertex
-						   cell->vertex(vertex) += shift_vector;
-						  // Add the current vertex to the list of already shifted vertices
-						   index_list.push_back(index_vertex);
-					   }
+					  }
 				  }
+
+				  if ( boundary_only )
+					  for (unsigned int face=0; face < GeometryInfo<dim>::faces_per_cell; ++face)
+						  if ( cell->face(face)->at_boundary() )
+							  for (unsigned int vertex=0; vertex < GeometryInfo<dim>::vertices_per_face; ++vertex)
+							  {
+								  const unsigned int index_vertex = cell->face(face)->vertex_index(vertex);
+								  if ( indexed[index_vertex]==false )
+								  {
+									  indexed[index_vertex] = true;
+									  indexed_vertices.push_back(index_vertex);
+								  }
+							  }
 			 }
+
+			// Choose the bin size, such that we get roughly one vertex per bin
+			 const std::vector< Point<dim> > &vertices = tria->get_vertices();
+			 Point<dim> p_min, p_max;
+			 if ( indexed_vertices.size()>0 )
+				 p_min = p_max = vertices[indexed_vertices[0]];
+			 for ( const unsigned int index_vertex : indexed_vertices )
+				 for ( unsigned int i=0; i<dim; i++ )
+				 {
+					 p_min[i] = std::min( p_min[i], vertices[index_vertex][i] );
+					 p_max[i] = std::max( p_max[i], vertices[index_vertex][i] );
+				 }
+			 double max_extent = 0.;
+			 for ( unsigned int i=0; i<dim; i++ )
+				 max_extent = std::max( max_extent, p_max[i]-p_min[i] );
+			 const double n_bins_per_direction = std::max( 1., std::floor( std::pow( double(indexed_vertices.size()), 1./dim ) ) );
+			 bin_size = ( max_extent > 0. ) ? max_extent / n_bins_per_direction : 1.;
+
+			// Sort the vertices into the bins
+			 key_min = get_bin_key( p_min );
+			 key_max = get_bin_key( p_max );
+			 bins.reserve( indexed_vertices.size() );
+			 for ( const unsigned int index_vertex : indexed_vertices )
+				 insert_into_bin( index_vertex, get_bin_key( vertices[index_vertex] ) );
+
+			outdated = false;
 		}
-		else /*only move the outer nodes of the notch inwards, this is limited to shallow notches and does not distort the inner cells*/
+
+		void insert_into_bin ( const unsigned int index_vertex, const std::array<long,dim> &key )
 		{
-			Assert( (radius - notch_radius) < radius/6.,
-					ExcMessage("Rod<< You choose the shallow notching, but your notch seems to be very deep. Consider using the deep notch option above."));
-			 for (typename Triangulation<dim>::active_cell_iterator
-			   cell = triangulation.begin_active();
-			   cell != triangulation.end(); ++cell)
-			 {
-			  for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-				if (cell->face(face)->at_boundary())
-				  for (unsigned int vertex=0; vertex<GeometryInfo<dim>::vertices_per_face; ++vertex)
-				  {
-					  // We look for all the points that lie in the notched area (y-coord in half length of notch)
-					   double y_coord = cell->face(face)->vertex(vertex)[y];
-					   if ( y_coord < half_notch_length )
-					   {
-						  double x_coord = cell->face(face)->vertex(vertex)[x];
-						  double z_coord = cell->face(face)->vertex(vertex)[z];
-						  // Look for point that lies on the outer surface
-						   if ( std::abs( std::sqrt(x_coord*x_coord + z_coord*z_coord) - radius ) < search_tolerance )
-						   {
-							  // The radius of the leftover notched material describes an arc along the y-coord.
-							  // Hence, the radius of the notch changes with the y-coord
-							   double current_notch_radius = R + notch_radius - std::sqrt( R*R - y_coord*y_coord );
-							  // Set the shift vector that moves the vertex inwards
-							   Point<dim> shift_vector;
-							   shift_vector[0] = (current_notch_radius - radius) / radius * x_coord ;
-							   shift_vector[2] = (current_notch_radius - radius) / radius * z_coord;
-							  // Apply the shift vector to the vertex
-							   cell->face(face)->vertex(vertex) += shift_vector;
-						   }
-					   }
-				  }
-			 }
+			bins[key].push_back( index_vertex );
+			vertex_keys[index_vertex] = key;
+			for ( unsigned int i=0; i<dim; i++ )
+			{
+				key_min[i] = std::min( key_min[i], key[i] );
+				key_max[i] = std::max( key_max[i], key[i] );
+			}
 		}
-	}
 
-	template <int dim>
-	class EvalPointClass
+		std::array<long,dim> get_bin_key ( const Point<dim> &point ) const
+		{
+			std::array<long,dim> key;
+			for ( unsigned int i=0; i<dim; i++ )
+				key[i] = long( std::floor( point[i] / bin_size ) );
+			return key;
+		}
+
+		/**
+		 * Check all bins with the (Chebyshev) distance \a ring from the bin \a key and
+		 * update the closest vertex if one is closer than \a distance_closest
+		 */
+		void search_ring ( const std::array<long,dim> &key, const long ring, const Point<dim> &point,
+						   unsigned int &index_closest, double &distance_closest ) const
+		{
+			const std::vector< Point<dim> > &vertices = tria->get_vertices();
+			const long n_per_direction = 2*ring+1;
+			long n_bins_in_cube = 1;
+			for ( unsigned int i=0; i<dim; i++ )
+				n_bins_in_cube *= n_per_direction;
+
+			for ( long bin_counter=0; bin_counter<n_bins_in_cube; bin_counter++ )
+			{
+				std::array<long,dim> key_neighbour = key;
+				bool on_ring = false;
+				for ( long i=0, digits=bin_counter; i<dim; i++, digits/=n_per_direction )
+				{
+					const long offset = digits%n_per_direction - ring;
+					key_neighbour[i] += offset;
+					if ( std::abs(offset)==ring )
+						on_ring = true;
+				}
+				// Skip the bins inside the ring, they were already checked
+				 if ( on_ring==false )
+					 continue;
+
+				const auto bin = bins.find( key_neighbour );
+				if ( bin != bins.end() )
+					for ( const unsigned int index_vertex : bin->second )
+					{
+						const double distance = vertices[index_vertex].distance(point);
+						if ( distance < distance_closest )
+						{
+							distance_closest = distance;
+							index_closest = index_vertex;
+						}
+					}
+			}
+		}
+
+		Triangulation<dim> *tria;
+		const bool boundary_only;
+		bool outdated = true;
+		boost::signals2::connection tria_listener;
+		double bin_size = 1.;
+		std::array<long,dim> key_min, key_max;
+		std::vector< typename Triangulation<dim>::active_cell_iterator > vertex_cells;
+		std::vector<unsigned int> vertex_in_cell;
+		std::vector<bool> indexed;
+		std::vector<unsigned int> indexed_vertices;
+		std::vector< std::array<long,dim> > vertex_keys;
+		std::unordered_map< std::array<long,dim>, std::vector<unsigned int>, BinKeyHash > bins;
+	};
+
+
+	/**
+	 * Shift the given points \a points of the triangulation \a tria by the vectors in \a shift
+	 * @note The points refer to the positions before the shift. Each vertex is shifted exactly once, even if it is listed
+	 * multiple times in \a points (with the same shift).
+	 */
+	template<int dim>
+	void shift_vertex_by_vector ( Triangulation<dim> &tria, const std::vector< Point<dim> > &points, const std::vector< Point<dim> > &shift, const std::string &numEx_name="" )
 	{
-	public:
-		EvalPointClass() = default;
+		AssertThrow( shift.size() == points.size(), ExcMessage(numEx_name+"<< We got "+std::to_string(shift.size())+" shift vectors for "
+															   +std::to_string(points.size())+" points."));
 
-		// Evaluation point and coordinate direction (x,y,z)
-		 EvalPointClass ( Point<3> eval_point , unsigned int direction )
-		 :
-		 eval_point(eval_point),
-		 direction(direction)
+		// Build the index once, so each point only costs a look into its neighbouring bins
+		 VertexIndex<dim> vertex_index ( tria );
+
+		// Find all the vertices before we shift any of them, so a shifted vertex cannot be mistaken for another point
+		 const unsigned int n_points = points.size();
+		 std::vector<unsigned int> point_vertices ( n_points );
+		 unsigned int n_missing_points = 0;
+		 for ( unsigned int i=0; i < n_points; i++)
 		 {
+			point_vertices[i] = vertex_index.find_vertex( points[i], 1e-12/*search_tolerance*/ );
+			if ( point_vertices[i] == numbers::invalid_unsigned_int )
+				n_missing_points += 1;
 		 }
-		// @todo-extent If needed we can also add a Point together with a direction vector for evaluation.
-		// This flexibility is actually the reason this class was created and not replaced by a std::pair or similar.
+		 AssertThrow( n_missing_points == 0, ExcMessage(numEx_name+"<< Distortion, "+std::to_string(n_missing_points)+" of the "
+														+std::to_string(n_points)+" points to be shifted are no vertices of the triangulation."));
 
-		 Point<3> eval_point;
-		 unsigned int direction = 99;
-
-		 double extract_disp_component ( const Vector<double> &pt_solution )
+		// Shift each vertex once, points listed repeatedly must have the same shift
+		 std::vector<unsigned int> shifting_point ( tria.n_vertices(), numbers::invalid_unsigned_int );
+		 for ( unsigned int i=0; i < n_points; i++)
 		 {
-			 if ( direction == 99 )
-				 AssertThrow( false, ExcMessage("EvalPointClass<< You have not declared the evaluation point properly. "
-						 	 	 	 	 	    "We require a direction (x,y,z) or a direction vector "
-						 	 	 	 	 	    "(the latter is not yet implemented)."));
-			 return pt_solution[direction];
+			const unsigned int index_vertex = point_vertices[i];
+			if ( shifting_point[index_vertex] == numbers::invalid_unsigned_int )
+			{
+				vertex_index.vertex(index_vertex) += shift[i];
+				vertex_index.update_bin(index_vertex);
+				shifting_point[index_vertex] = i;
+			}
+			else
+				AssertThrow( (shift[i] - shift[shifting_point[index_vertex]]).norm() < 1e-12,
+							 ExcMessage(numEx_name+"<< The points "+std::to_string(shifting_point[index_vertex])+" and "+std::to_string(i)
+										+" refer to the same vertex, but are shifted differently."));
 		 }
+	}
+
+
+	/**
+	 * Vertex-centric transformation engine: Apply the \a transformation to each unique vertex of the \a vertex_index exactly once.
+	 * The \a transformation gets write access to the current position of the vertex and returns whether it moved the vertex.
+	 * Because each vertex is visited once and the transformation only writes to this vertex, we process the vertices in parallel.
+	 * @param selected_vertices Optional mask (indexed by the global vertex index) to restrict the transformation to a subset of vertices
+	 * @return The number of moved vertices
+	 * @note The \a transformation must not depend on the positions of other vertices, because these might be moved concurrently.
+	 */
+	template<int dim, typename TransformationType>
+	unsigned int transform_vertices ( VertexIndex<dim> &vertex_index, const TransformationType &transformation,
+									  const std::vector<bool> &selected_vertices = std::vector<bool>() )
+	{
+		const std::vector<unsigned int> &indexed_vertices = vertex_index.get_indexed_vertices();
+		std::atomic<unsigned int> n_moved_vertices (0);
+		// @note We use unsigned char instead of bool, because std::vector<bool> cannot be written concurrently
+		 std::vector<unsigned char> moved ( indexed_vertices.size(), 0 );
+
+		parallel::apply_to_subranges( 0u, static_cast<unsigned int>(indexed_vertices.size()),
+									  [&] ( const unsigned int begin, const unsigned int end )
+									  {
+										  unsigned int n_moved_vertices_subrange = 0;
+										  for ( unsigned int i=begin; i<end; i++ )
+										  {
+											  const unsigned int index_vertex = indexed_vertices[i];
+											  if ( selected_vertices.empty() || selected_vertices[index_vertex] )
+												  if ( transformation( vertex_index.vertex(index_vertex) ) )
+												  {
+													  moved[i] = 1;
+													  n_moved_vertices_subrange += 1;
+												  }
+										  }
+										  n_moved_vertices += n_moved_vertices_subrange;
+									  },
+									  /*grainsize*/ 1024 );
+
+		// Keep the index consistent for subsequent queries (serial, only the moved vertices)
+		 if ( n_moved_vertices > 0 )
+			 for ( unsigned int i=0; i<indexed_vertices.size(); i++ )
+				 if ( moved[i] )
+					 vertex_index.update_bin( indexed_vertices[i] );
+
+		return n_moved_vertices;
+	}
+
+	
+	template<int dim>
+	Point<dim> extract_dim ( const Point<3> &point_3D )
+	{
+		Point<dim> point_dim;
+		for ( unsigned int i=0; i<dim; i++)
+			point_dim[i] = point_3D[i];
+		
+		return point_dim;
+	}
+	
+	/**
+	 * Clear boundary ID's
+	 */
+	template<int dim>
+	void clear_boundary_IDs ( Triangulation<dim> &triangulation )
+	{
+		// Iterate over each active face of the triangulation (each face only once instead of once per adjacent cell)
+		for ( typename Triangulation<dim>::active_face_iterator
+			  face = triangulation.begin_active_face();
+			  face != triangulation.end_face(); ++face )
+		{
+			// Iterate only over faces that lay at the boundary
+			 if ( face->at_boundary() )
+				 // Set the the boundary ids to zero (standard|unassigned value)
+				  face->set_all_boundary_ids(0);
+		}
+	}
+	
+	/**
+	 * Check whether the \a triangulation is partitioned over several MPI ranks (e.g. parallel::distributed::Triangulation)
+	 */
+	template<int dim>
+	bool is_distributed ( const Triangulation<dim> &triangulation )
+	{
+		return ( triangulation.locally_owned_subdomain() != numbers::invalid_subdomain_id );
+	}
+
+	/**
+	 * Select the triangulation the serial part of a \a make_grid function works on:
+	 * For a serial \a triangulation this is the \a triangulation itself, for a distributed one the auxiliary \a tria_serial.
+	 * Everything p4est cannot do (merging, anisotropic refinements, shifting vertices before further refinements) belongs
+	 * into this serial part. Every rank builds the same serial mesh, so no communication is needed.
+	 */
+	template<int dim>
+	Triangulation<dim> &get_serial_triangulation ( Triangulation<dim> &triangulation, Triangulation<dim> &tria_serial )
+	{
+		return is_distributed(triangulation) ? tria_serial : triangulation;
+	}
+
+	/**
+	 * Turn the active cells of the serial mesh \a tria_serial into the coarse mesh of the distributed \a triangulation.
+	 * The boundary, manifold and material ids are copied by the flattening, the manifold objects are attached again.
+	 * Afterwards, the isotropic refinements are done on the distributed \a triangulation, so each rank only refines its own cells.
+	 * Hence, \a tria_serial must not contain hanging nodes, local refinements belong after the distribution.
+	 * @note Does nothing if \a tria_serial is the \a triangulation itself (serial case, see \a get_serial_triangulation).
+	 */
+	template<int dim>
+	void distribute_serial_triangulation ( const Triangulation<dim> &tria_serial, Triangulation<dim> &triangulation )
+	{
+		if ( &tria_serial == &triangulation )
+			return;
+
+		// The flattened mesh only consists of the active cells, which must not have hanging nodes
+		 AssertThrow( !tria_serial.has_hanging_nodes(),
+					  ExcMessage("distribute_serial_triangulation<< The serial mesh has hanging nodes and cannot be flattened. "
+								 "Do the local refinements on the distributed triangulation instead."));
+
+		triangulation.clear();
+		GridGenerator::flatten_triangulation( tria_serial, triangulation );
+
+		const std::vector<types::manifold_id> manifold_ids = tria_serial.get_manifold_ids();
+		for ( unsigned int i=0; i<manifold_ids.size(); i++ )
+			if ( manifold_ids[i] != numbers::flat_manifold_id )
+				triangulation.set_manifold( manifold_ids[i], tria_serial.get_manifold(manifold_ids[i]) );
+	}
+
+	/**
+	 * Create the fully distributed \a triangulation from the serial mesh built by \a make_serial_grid.
+	 * In contrast to \a distribute_serial_triangulation, only the first rank builds the serial mesh. It partitions the mesh and
+	 * each rank receives only its locally owned cells and the ghost layer, so the other ranks never store the entire mesh.
+	 * The serial mesh is flattened (see \a distribute_serial_triangulation), hence it may also contain anisotropic refinements, but no hanging nodes.
+	 * Afterwards, \a refine_flat_grid can refine the flattened mesh locally. The fully distributed triangulation recreates these
+	 * refinements from the description, so they have to be isotropic.
+	 * @note The description of the mesh only contains the manifold ids, so the manifold objects have to be attached afterwards.
+	 */
+	template<int dim>
+	void create_fully_distributed_triangulation ( parallel::fullydistributed::Triangulation<dim> &triangulation,
+												  const std::function<void(Triangulation<dim>&)> &make_serial_grid,
+												  const std::function<void(Triangulation<dim>&)> &refine_flat_grid = std::function<void(Triangulation<dim>&)>() )
+	{
+		const MPI_Comm mpi_communicator = triangulation.get_communicator();
+
+		const TriangulationDescription::Description<dim,dim> description
+			= TriangulationDescription::Utilities::create_description_from_triangulation_in_groups<dim,dim>(
+				[&] ( Triangulation<dim> &tria_flat )
+				{
+					Triangulation<dim> tria_serial;
+					make_serial_grid( tria_serial );
+					distribute_serial_triangulation( tria_serial, tria_flat );
+					if ( refine_flat_grid )
+						refine_flat_grid( tria_flat );
+				},
+				[] ( Triangulation<dim> &tria_flat, const MPI_Comm comm, const unsigned int /*group_size*/ )
+				{
+					GridTools::partition_triangulation( Utilities::MPI::n_mpi_processes(comm), tria_flat );
+				},
+				mpi_communicator,
+				/*group_size: all ranks in one group, so only the first rank builds the mesh*/ Utilities::MPI::n_mpi_processes(mpi_communicator) );
+
+		triangulation.create_triangulation( description );
+	}
+
+	/**
+	 * Declarative assignment of the boundary ids: A list of geometric predicates (plane, cylinder, sphere, box)
+	 * is mapped to boundary ids and evaluated on the boundary faces only.
+	 * As in the hand-written if-else chains, the predicates are tested in the order they were added and
+	 * the first matching predicate determines the boundary id of the face.
+	 * The faces are classified in parallel, because each face is tested independently of all the others.
+	 * By default, \a apply also clears the ids of the remaining boundary faces in the same pass, so no separate
+	 * \a clear_boundary_IDs is needed before.
+	 * @note Points and directions are given as Point<3> (as for the NotchClass), so the same predicates can be used in 2D and 3D.
+	 */
+	template<int dim>
+	class BoundaryClassifier
+	{
+	public:
+		enum enum_test
+		{
+			test_face_center = 0, //!< The centre of the face has to satisfy the predicate
+			test_any_vertex = 1   //!< At least one vertex of the face has to satisfy the predicate (e.g. curved boundaries, where only the vertices sit on the curve)
+		};
+
+		BoundaryClassifier ( const double search_tolerance=1e-12 )
+		:
+		tolerance(search_tolerance)
+		{
+		}
+
+		/**
+		 * Faces on the plane x_{direction} = \a position
+		 */
+		BoundaryClassifier<dim> &add_plane ( const unsigned int direction, const double position, const types::boundary_id boundary_id )
+		{
+			AssertThrow( direction<dim, ExcMessage("BoundaryClassifier<< The normal direction of the plane exceeds the dimension."));
+			Predicate predicate ( predicate_plane, boundary_id, test_face_center );
+			 predicate.direction = direction;
+			 predicate.radius = position;
+			 predicates.push_back(predicate);
+			return *this;
+		}
+
+		/**
+		 * Faces on the lateral surface of the cylinder around the axis in the coordinate direction \a axis_direction
+		 * through the point \a axis_point. In 2D the cylinder with the axis in z-direction describes a circle in the xy-plane.
+		 */
+		BoundaryClassifier<dim> &add_cylinder ( const unsigned int axis_direction, const double radius, const types::boundary_id boundary_id,
+												const Point<3> &axis_point=Point<3>(), const unsigned int test=test_face_center )
+		{
+			Predicate predicate ( predicate_cylinder, boundary_id, test );
+			 predicate.direction = axis_direction;
+			 predicate.radius = radius;
+			 predicate.point_1 = axis_point;
+			 predicates.push_back(predicate);
+			return *this;
+		}
+
+		/**
+		 * Faces on the sphere (circle in 2D) with the \a center and the \a radius
+		 */
+		BoundaryClassifier<dim> &add_sphere ( const Point<3> &center, const double radius, const types::boundary_id boundary_id,
+											  const unsigned int test=test_face_center )
+		{
+			Predicate predicate ( predicate_sphere, boundary_id, test );
+			 predicate.radius = radius;
+			 predicate.point_1 = center;
+			 predicates.push_back(predicate);
+			return *this;
+		}
+
+		/**
+		 * Faces inside the axis-aligned box spanned by the corners \a p1 and \a p2 (e.g. a part of a plane)
+		 */
+		BoundaryClassifier<dim> &add_box ( const Point<3> &p1, const Point<3> &p2, const types::boundary_id boundary_id,
+										   const unsigned int test=test_face_center )
+		{
+			Predicate predicate ( predicate_box, boundary_id, test );
+			 for ( unsigned int i=0; i<3; i++ )
+			 {
+				 predicate.point_1[i] = std::min( p1[i], p2[i] );
+				 predicate.point_2[i] = std::max( p1[i], p2[i] );
+			 }
+			 predicates.push_back(predicate);
+			return *this;
+		}
+
+		/**
+		 * Restrict the last added predicate to points inside the axis-aligned box spanned by \a p1 and \a p2,
+		 * e.g. to only detect the part of a circle that lies above a certain coordinate
+		 */
+		BoundaryClassifier<dim> &restrict_to_box ( const Point<3> &p1, const Point<3> &p2 )
+		{
+			AssertThrow( !predicates.empty(), ExcMessage("BoundaryClassifier<< There is no predicate to be restricted. Add the predicate first."));
+			Predicate &predicate = predicates.back();
+			 predicate.restricted = true;
+			 for ( unsigned int i=0; i<3; i++ )
+			 {
+				 predicate.restriction_1[i] = std::min( p1[i], p2[i] );
+				 predicate.restriction_2[i] = std::max( p1[i], p2[i] );
+			 }
+			return *this;
+		}
+
+		/**
+		 * Assign the boundary ids to all boundary faces of the \a triangulation
+		 * @param clear_existing_IDs Reset the boundary ids of the faces that match none of the predicates to zero (as \a clear_boundary_IDs).
+		 * Both steps are done in the same pass over the boundary faces.
+		 * @return The number of boundary faces that match none of the predicates
+		 */
+		unsigned int apply ( Triangulation<dim> &triangulation, const bool clear_existing_IDs=true ) const
+		{
+			// Gather the boundary faces (each face only once instead of once per adjacent cell)
+			 std::vector< typename Triangulation<dim>::active_face_iterator > boundary_faces;
+			 for ( typename Triangulation<dim>::active_face_iterator
+				   face = triangulation.begin_active_face();
+				   face != triangulation.end_face(); ++face )
+				 if ( face->at_boundary() )
+					 boundary_faces.push_back(face);
+
+			// Classify the faces in parallel
+			 std::vector<types::boundary_id> face_ids ( boundary_faces.size(), numbers::invalid_boundary_id );
+			 parallel::apply_to_subranges( 0u, static_cast<unsigned int>(boundary_faces.size()),
+										   [&] ( const unsigned int begin, const unsigned int end )
+										   {
+											   for ( unsigned int i=begin; i<end; i++ )
+												   face_ids[i] = classify( boundary_faces[i] );
+										   },
+										   /*grainsize*/ 256 );
+
+			// Set the boundary ids (serial, this only touches the boundary faces)
+			 unsigned int n_unclassified_faces = 0;
+			 for ( unsigned int i=0; i<boundary_faces.size(); i++ )
+			 {
+				 if ( clear_existing_IDs )
+					 boundary_faces[i]->set_all_boundary_ids(0);
+
+				 if ( face_ids[i] != numbers::invalid_boundary_id )
+					 boundary_faces[i]->set_boundary_id( face_ids[i] );
+				 else
+					 n_unclassified_faces += 1;
+			 }
+
+			return n_unclassified_faces;
+		}
+
+	private:
+		enum enum_predicate
+		{
+			predicate_plane = 0,
+			predicate_cylinder = 1,
+			predicate_sphere = 2,
+			predicate_box = 3
+		};
+
+		struct Predicate
+		{
+			Predicate ( const unsigned int predicate_type, const types::boundary_id predicate_id, const unsigned int predicate_test )
+			:
+			type(predicate_type),
+			boundary_id(predicate_id),
+			test(predicate_test)
+			{
+			}
+
+			unsigned int type;
+			types::boundary_id boundary_id;
+			unsigned int test;
+			unsigned int direction = 0;
+			double radius = 0.;	// also the position of the plane
+			Point<3> point_1;
+			Point<3> point_2;
+			bool restricted = false;
+			Point<3> restriction_1;
+			Point<3> restriction_2;
+		};
+
+		bool inside_box ( const Point<dim> &point, const Point<3> &p1, const Point<3> &p2 ) const
+		{
+			for ( unsigned int i=0; i<dim; i++ )
+				if ( point[i] < p1[i] - tolerance || point[i] > p2[i] + tolerance )
+					return false;
+			return true;
+		}
+
+		bool satisfies ( const Predicate &predicate, const Point<dim> &point ) const
+		{
+			if ( predicate.restricted && !inside_box( point, predicate.restriction_1, predicate.restriction_2 ) )
+				return false;
+
+			switch ( predicate.type )
+			{
+				case predicate_plane:
+					return ( std::abs( point[predicate.direction] - predicate.radius ) < tolerance );
+				case predicate_cylinder:
+				{
+					// Distance to the axis, so only the coordinates perpendicular to the axis
+					 double distance_sqr = 0.;
+					 for ( unsigned int i=0; i<dim; i++ )
+						 if ( i != predicate.direction )
+							 distance_sqr += ( point[i] - predicate.point_1[i] ) * ( point[i] - predicate.point_1[i] );
+					return ( std::abs( std::sqrt(distance_sqr) - predicate.radius ) < tolerance );
+				}
+				case predicate_sphere:
+					return ( std::abs( point.distance( extract_dim<dim>(predicate.point_1) ) - predicate.radius ) < tolerance );
+				case predicate_box:
+					return inside_box( point, predicate.point_1, predicate.point_2 );
+				default:
+					AssertThrow(false, ExcMessage("BoundaryClassifier<< predicate type not implemented"));
+					return false;
+			}
+		}
+
+		types::boundary_id classify ( const typename Triangulation<dim>::active_face_iterator &face ) const
+		{
+			const Point<dim> face_center = face->center();
+			for ( unsigned int p=0; p<predicates.size(); p++ )
+			{
+				const Predicate &predicate = predicates[p];
+				if ( predicate.test == test_face_center )
+				{
+					if ( satisfies( predicate, face_center ) )
+						return predicate.boundary_id;
+				}
+				else
+				{
+					for ( unsigned int vertex=0; vertex<GeometryInfo<dim>::vertices_per_face; ++vertex )
+						if ( satisfies( predicate, face->vertex(vertex) ) )
+							return predicate.boundary_id;
+				}
+			}
+			return numbers::invalid_boundary_id;
+		}
+
+		const double tolerance;
+		std::vector<Predicate> predicates;
+	};
+
+	/**
+	 * Binary data array for the VTU output: The values are streamed into the file as base64 (inline "binary" format of VTK).
+	 * Without compression the values are directly encoded, so we never hold the data in memory. With zlib compression
+	 * the values are compressed in blocks of 32 KiB, which we have to keep until the end of the data array, because the
+	 * VTK header lists the sizes of all compressed blocks in front of the data.
+	 * @note The total number of bytes \a n_bytes has to be known in advance (it is part of the header of an uncompressed array).
+	 */
+	class VtuBinaryDataArray
+	{
+	public:
+		VtuBinaryDataArray ( std::ostream &output_stream, const bool compress_data, const std::uint64_t n_bytes )
+		:
+		out(output_stream),
+		compress(compress_data),
+		n_bytes_total(n_bytes)
+		{
+			#ifndef DEAL_II_WITH_ZLIB
+			 AssertThrow( !compress, ExcMessage("numEx - VtuBinaryDataArray<< Compressed output requires deal.II to be configured with zlib."));
+			#endif
+
+			if ( !compress )
+				encode( reinterpret_cast<const unsigned char*>(&n_bytes_total), sizeof(std::uint64_t) );
+			else
+				block.reserve( block_size );
+		}
+
+		template<typename Number>
+		void push ( const Number value )
+		{
+			append( reinterpret_cast<const unsigned char*>(&value), sizeof(Number) );
+		}
+
+		/**
+		 * Finish the data array, this has to be called exactly once after the last value
+		 */
+		void finish ()
+		{
+			AssertThrow( n_bytes_written==n_bytes_total, ExcMessage("numEx - VtuBinaryDataArray<< The number of written bytes does not match the announced size."));
+			if ( !compress )
+				end_encoding();
+			else
+			{
+				#ifdef DEAL_II_WITH_ZLIB
+				 if ( !block.empty() )
+					 compress_block();
+
+				 // Header: number of blocks, block size, size of the last partial block (0 if the last block is full), compressed block sizes
+				  std::vector<std::uint64_t> header;
+				  header.push_back( compressed_blocks.size() );
+				  header.push_back( block_size );
+				  header.push_back( n_bytes_total % block_size );
+				  for ( unsigned int i=0; i<compressed_blocks.size(); i++ )
+					  header.push_back( compressed_blocks[i].size() );
+				  encode( reinterpret_cast<const unsigned char*>(header.data()), header.size()*sizeof(std::uint64_t) );
+				  end_encoding();
+
+				 // The compressed data is encoded separately from the header
+				  for ( unsigned int i=0; i<compressed_blocks.size(); i++ )
+					  encode( compressed_blocks[i].data(), compressed_blocks[i].size() );
+				  end_encoding();
+				#endif
+			}
+		}
+
+	private:
+		void append ( const unsigned char *data, const std::size_t n_bytes )
+		{
+			n_bytes_written += n_bytes;
+			if ( !compress )
+				encode( data, n_bytes );
+			else
+				for ( std::size_t i=0; i<n_bytes; i++ )
+				{
+					block.push_back( data[i] );
+					if ( block.size()==block_size )
+						compress_block();
+				}
+		}
+
+		void compress_block ()
+		{
+			#ifdef DEAL_II_WITH_ZLIB
+			 uLongf compressed_size = compressBound( block.size() );
+			 std::vector<unsigned char> compressed_block ( compressed_size );
+			 const int status = compress2( compressed_block.data(), &compressed_size, block.data(), block.size(), Z_BEST_SPEED );
+			 AssertThrow( status==Z_OK, ExcMessage("numEx - VtuBinaryDataArray<< zlib failed to compress the data."));
+			 compressed_block.resize( compressed_size );
+			 compressed_blocks.push_back( compressed_block );
+			 block.clear();
+			#endif
+		}
+
+		// Streaming base64 encoder, we carry at most two bytes between the calls
+		void encode ( const unsigned char *data, const std::size_t n_bytes )
+		{
+			for ( std::size_t i=0; i<n_bytes; i++ )
+			{
+				carry[n_carry++] = data[i];
+				if ( n_carry==3 )
+				{
+					out << base64_chars[ carry[0] >> 2 ]
+						<< base64_chars[ ((carry[0] & 0x03) << 4) | (carry[1] >> 4) ]
+						<< base64_chars[ ((carry[1] & 0x0f) << 2) | (carry[2] >> 6) ]
+						<< base64_chars[ carry[2] & 0x3f ];
+					n_carry = 0;
+				}
+			}
+		}
+
+		void end_encoding ()
+		{
+			if ( n_carry==1 )
+				out << base64_chars[ carry[0] >> 2 ] << base64_chars[ (carry[0] & 0x03) << 4 ] << "==";
+			else if ( n_carry==2 )
+				out << base64_chars[ carry[0] >> 2 ]
+					<< base64_chars[ ((carry[0] & 0x03) << 4) | (carry[1] >> 4) ]
+					<< base64_chars[ (carry[1] & 0x0f) << 2 ] << '=';
+			n_carry = 0;
+		}
+
+		std::ostream &out;
+		const bool compress;
+		const std::uint64_t n_bytes_total;
+		std::uint64_t n_bytes_written = 0;
+
+		unsigned char carry[3];
+		unsigned int n_carry = 0;
+		const char *base64_chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+		const std::size_t block_size = 32768;
+		std::vector<unsigned char> block;
+		std::vector< std::vector<unsigned char> > compressed_blocks;
+	};
+
+	/**
+	 * Call \a function(cell,face) for each element of the mesh output: each active cell (\a face = -1) followed by its boundary faces.
+	 * For a distributed triangulation we only consider the locally owned cells.
+	 */
+	template<int dim, typename FunctionType>
+	void for_each_output_element ( const Triangulation<dim> &triangulation, const FunctionType &function )
+	{
+		for ( typename Triangulation<dim>::active_cell_iterator
+			  cell = triangulation.begin_active();
+			  cell != triangulation.end(); ++cell )
+			if ( cell->is_locally_owned() )
+			{
+				function( cell, -1 );
+				for ( unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face )
+					if ( cell->face(face)->at_boundary() )
+						function( cell, int(face) );
+			}
+	}
+
+	/**
+	 * Write the \a triangulation as binary VTU file \a filename (UnstructuredGrid, inline base64 data, optionally zlib compressed).
+	 * Besides the cells we write the boundary faces as lower dimensional cells, so we can output the material id of the cells
+	 * as well as the boundary id of the faces and the manifold ids of both (-1 marks "not applicable" and the flat manifold).
+	 * For a distributed triangulation each process writes its locally owned cells into its own piece
+	 * "<filename>_<rank>.vtu" and the first process additionally writes the master file "<filename>.pvtu".
+	 * @param filename Name of the file without the extension
+	 */
+	template<int dim>
+	void write_vtu_binary ( const Triangulation<dim> &triangulation, const std::string &filename, const bool compress=false )
+	{
+		AssertThrow( dim>1, ExcMessage("numEx - write_vtu_binary<< Only implemented for 2D and 3D."));
+
+		// The VTK vertex order of lines, quads and hexahedra, compared to the lexicographic vertex numbering of deal.II
+		 const unsigned int vtk_vertex_order[8] = {0,1,3,2,4,5,7,6};
+		 const unsigned int vtk_cell_type = ( dim==2 ? 9/*VTK_QUAD*/ : 12/*VTK_HEXAHEDRON*/ );
+		 const unsigned int vtk_face_type = ( dim==2 ? 3/*VTK_LINE*/ : 9/*VTK_QUAD*/ );
+
+		// A distributed triangulation writes one piece per process
+		 const bool distributed = ( triangulation.locally_owned_subdomain() != numbers::invalid_subdomain_id );
+		 std::string piece_filename = filename + ".vtu";
+		 if ( distributed )
+			 piece_filename = filename + "_" + Utilities::int_to_string(triangulation.locally_owned_subdomain(),4) + ".vtu";
+
+		// Number the vertices that are used by the written cells consecutively (skips unused and not owned vertices)
+		 std::vector<unsigned int> point_index ( triangulation.n_vertices(), numbers::invalid_unsigned_int );
+		 std::vector<unsigned int> written_vertices;
+		 std::uint64_t n_elements = 0;
+		 std::uint64_t n_connectivity = 0;
+		 for_each_output_element( triangulation,
+								  [&] ( const typename Triangulation<dim>::active_cell_iterator &cell, const int face )
+								  {
+									  n_elements += 1;
+									  n_connectivity += ( face<0 ? GeometryInfo<dim>::vertices_per_cell : GeometryInfo<dim>::vertices_per_face );
+									  if ( face<0 )
+										  for ( unsigned int v=0; v<GeometryInfo<dim>::vertices_per_cell; ++v )
+											  if ( point_index[cell->vertex_index(v)] == numbers::invalid_unsigned_int )
+											  {
+												  point_index[cell->vertex_index(v)] = written_vertices.size();
+												  written_vertices.push_back( cell->vertex_index(v) );
+											  }
+								  } );
+
+		std::ofstream out ( piece_filename.c_str(), std::ios::binary );
+		AssertThrow( out, ExcMessage("numEx - write_vtu_binary<< Could not open the file "+piece_filename));
+
+		const unsigned int endian_test = 1;
+		const bool little_endian = ( *reinterpret_cast<const unsigned char*>(&endian_test) == 1 );
+
+		out << "<?xml version=\"1.0\"?>\n"
+			<< "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"" << ( little_endian ? "LittleEndian" : "BigEndian" ) << "\""
+			<< " header_type=\"UInt64\"" << ( compress ? " compressor=\"vtkZLibDataCompressor\"" : "" ) << ">\n"
+			<< "<UnstructuredGrid>\n"
+			<< "<Piece NumberOfPoints=\"" << written_vertices.size() << "\" NumberOfCells=\"" << n_elements << "\">\n";
+
+		// Points (always 3 coordinates for VTK)
+		 out << "<Points>\n<DataArray type=\"Float64\" NumberOfComponents=\"3\" format=\"binary\">\n";
+		 {
+			VtuBinaryDataArray data_array ( out, compress, written_vertices.size()*3*sizeof(double) );
+			const std::vector< Point<dim> > &vertices = triangulation.get_vertices();
+			for ( unsigned int i=0; i<written_vertices.size(); i++ )
+				for ( unsigned int d=0; d<3; d++ )
+					data_array.push( double( d<dim ? vertices[written_vertices[i]][d] : 0. ) );
+			data_array.finish();
+		 }
+		 out << "\n</DataArray>\n</Points>\n";
+
+		// Cells: connectivity, offsets, types
+		 out << "<Cells>\n<DataArray type=\"Int64\" Name=\"connectivity\" format=\"binary\">\n";
+		 {
+			VtuBinaryDataArray data_array ( out, compress, n_connectivity*sizeof(std::int64_t) );
+			for_each_output_element( triangulation,
+									 [&] ( const typename Triangulation<dim>::active_cell_iterator &cell, const int face )
+									 {
+										 if ( face<0 )
+											 for ( unsigned int v=0; v<GeometryInfo<dim>::vertices_per_cell; ++v )
+												 data_array.push( std::int64_t( point_index[ cell->vertex_index(vtk_vertex_order[v]) ] ) );
+										 else
+											 for ( unsigned int v=0; v<GeometryInfo<dim>::vertices_per_face; ++v )
+												 data_array.push( std::int64_t( point_index[ cell->face(face)->vertex_index(vtk_vertex_order[v]) ] ) );
+									 } );
+			data_array.finish();
+		 }
+		 out << "\n</DataArray>\n<DataArray type=\"Int64\" Name=\"offsets\" format=\"binary\">\n";
+		 {
+			VtuBinaryDataArray data_array ( out, compress, n_elements*sizeof(std::int64_t) );
+			std::int64_t offset = 0;
+			for_each_output_element( triangulation,
+									 [&] ( const typename Triangulation<dim>::active_cell_iterator &, const int face )
+									 {
+										 offset += ( face<0 ? GeometryInfo<dim>::vertices_per_cell : GeometryInfo<dim>::vertices_per_face );
+										 data_array.push( offset );
+									 } );
+			data_array.finish();
+		 }
+		 out << "\n</DataArray>\n<DataArray type=\"UInt8\" Name=\"types\" format=\"binary\">\n";
+		 {
+			VtuBinaryDataArray data_array ( out, compress, n_elements*sizeof(std::uint8_t) );
+			for_each_output_element( triangulation,
+									 [&] ( const typename Triangulation<dim>::active_cell_iterator &, const int face )
+									 {
+										 data_array.push( std::uint8_t( face<0 ? vtk_cell_type : vtk_face_type ) );
+									 } );
+			data_array.finish();
+		 }
+		 out << "\n</DataArray>\n</Cells>\n";
+
+		// Cell data: material id, boundary id and manifold id
+		 out << "<CellData Scalars=\"material_id\">\n";
+		 const std::string data_names[3] = {"material_id","boundary_id","manifold_id"};
+		 for ( unsigned int i=0; i<3; i++ )
+		 {
+			out << "<DataArray type=\"Int32\" Name=\"" << data_names[i] << "\" format=\"binary\">\n";
+			VtuBinaryDataArray data_array ( out, compress, n_elements*sizeof(std::int32_t) );
+			for_each_output_element( triangulation,
+									 [&] ( const typename Triangulation<dim>::active_cell_iterator &cell, const int face )
+									 {
+										 std::int32_t id = -1;
+										 if ( i==0 && face<0 )
+											 id = cell->material_id();
+										 else if ( i==1 && face>=0 )
+											 id = cell->face(face)->boundary_id();
+										 else if ( i==2 )
+										 {
+											 const types::manifold_id manifold_id = ( face<0 ? cell->manifold_id() : cell->face(face)->manifold_id() );
+											 if ( manifold_id != numbers::flat_manifold_id )
+												 id = manifold_id;
+										 }
+										 data_array.push( id );
+									 } );
+			data_array.finish();
+			out << "\n</DataArray>\n";
+		 }
+		 out << "</CellData>\n</Piece>\n</UnstructuredGrid>\n</VTKFile>\n";
+		out.close();
+
+		// The master file for all pieces
+		 if ( distributed && triangulation.locally_owned_subdomain()==0 )
+		 {
+			std::ofstream out_master ( (filename+".pvtu").c_str() );
+			out_master << "<?xml version=\"1.0\"?>\n"
+					   << "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\" byte_order=\"" << ( little_endian ? "LittleEndian" : "BigEndian" ) << "\""
+					   << " header_type=\"UInt64\">\n"
+					   << "<PUnstructuredGrid GhostLevel=\"0\">\n"
+					   << "<PPoints>\n<PDataArray type=\"Float64\" NumberOfComponents=\"3\"/>\n</PPoints>\n"
+					   << "<PCellData Scalars=\"material_id\">\n";
+			for ( unsigned int i=0; i<3; i++ )
+				out_master << "<PDataArray type=\"Int32\" Name=\"" << data_names[i] << "\"/>\n";
+			out_master << "</PCellData>\n";
+
+			// Only the file name without the path, because the pieces are stored next to the master file
+			 const std::string basename = filename.substr( filename.find_last_of('/')+1 );
+			 const unsigned int n_processes = Utilities::MPI::n_mpi_processes( triangulation.get_communicator() );
+			 for ( unsigned int p=0; p<n_processes; p++ )
+				 out_master << "<Piece Source=\"" << basename << "_" << Utilities::int_to_string(p,4) << ".vtu\"/>\n";
+			out_master << "</PUnstructuredGrid>\n</VTKFile>\n";
+		 }
+	}
+
+	/**
+	 * Write the \a triangulation as binary Gmsh file (format 2.2) \a filename.
+	 * Besides the cells we write the boundary faces, so the physical tag contains the material id of a cell and the boundary id of a face.
+	 * The elementary tag contains the manifold id plus two and 1 for the flat manifold, because Gmsh readers expect positive tags.
+	 * The elements are streamed into the file, we only keep the renumbering of the vertices in memory.
+	 * @note For a distributed triangulation each process writes its locally owned cells into "<filename>_<rank>.msh".
+	 * @param filename Name of the file without the extension
+	 */
+	template<int dim>
+	void write_msh_binary ( const Triangulation<dim> &triangulation, const std::string &filename )
+	{
+		AssertThrow( dim>1, ExcMessage("numEx - write_msh_binary<< Only implemented for 2D and 3D."));
+
+		// The Gmsh vertex order of lines, quads and hexahedra, compared to the lexicographic vertex numbering of deal.II
+		 const unsigned int gmsh_vertex_order[8] = {0,1,3,2,4,5,7,6};
+		 const int gmsh_cell_type = ( dim==2 ? 3/*quad*/ : 5/*hexahedron*/ );
+		 const int gmsh_face_type = ( dim==2 ? 1/*line*/ : 3/*quad*/ );
+
+		std::string msh_filename = filename + ".msh";
+		if ( triangulation.locally_owned_subdomain() != numbers::invalid_subdomain_id )
+			msh_filename = filename + "_" + Utilities::int_to_string(triangulation.locally_owned_subdomain(),4) + ".msh";
+
+		// Number the vertices that are used by the written cells consecutively, Gmsh starts counting at 1
+		 std::vector<int> node_tag ( triangulation.n_vertices(), 0 );
+		 std::vector<unsigned int> written_vertices;
+		 unsigned int n_elements = 0;
+		 for_each_output_element( triangulation,
+								  [&] ( const typename Triangulation<dim>::active_cell_iterator &cell, const int face )
+								  {
+									  n_elements += 1;
+									  if ( face<0 )
+										  for ( unsigned int v=0; v<GeometryInfo<dim>::vertices_per_cell; ++v )
+											  if ( node_tag[cell->vertex_index(v)] == 0 )
+											  {
+												  written_vertices.push_back( cell->vertex_index(v) );
+												  node_tag[cell->vertex_index(v)] = written_vertices.size();
+											  }
+								  } );
+
+		std::ofstream out ( msh_filename.c_str(), std::ios::binary );
+		AssertThrow( out, ExcMessage("numEx - write_msh_binary<< Could not open the file "+msh_filename));
+
+		// Header with the integer 1 to detect the endianness
+		 const int one = 1;
+		 out << "$MeshFormat\n2.2 1 " << sizeof(double) << "\n";
+		 out.write( reinterpret_cast<const char*>(&one), sizeof(int) );
+		 out << "\n$EndMeshFormat\n";
+
+		// Nodes: tag and always 3 coordinates
+		 out << "$Nodes\n" << written_vertices.size() << "\n";
+		 const std::vector< Point<dim> > &vertices = triangulation.get_vertices();
+		 for ( unsigned int i=0; i<written_vertices.size(); i++ )
+		 {
+			const int tag = i+1;
+			out.write( reinterpret_cast<const char*>(&tag), sizeof(int) );
+			for ( unsigned int d=0; d<3; d++ )
+			{
+				const double coord = ( d<dim ? vertices[written_vertices[i]][d] : 0. );
+				out.write( reinterpret_cast<const char*>(&coord), sizeof(double) );
+			}
+		 }
+		 out << "\n$EndNodes\n";
+
+		// Elements: each element with its own header (type, 1 element, 2 tags)
+		 out << "$Elements\n" << n_elements << "\n";
+		 int element_tag = 0;
+		 for_each_output_element( triangulation,
+								  [&] ( const typename Triangulation<dim>::active_cell_iterator &cell, const int face )
+								  {
+									  const types::manifold_id manifold_id = ( face<0 ? cell->manifold_id() : cell->face(face)->manifold_id() );
+									  const int header[3] = { ( face<0 ? gmsh_cell_type : gmsh_face_type ), 1, 2 };
+									  // Element number, physical tag, elementary tag, nodes
+									  int element[3+GeometryInfo<dim>::vertices_per_cell];
+									   element[0] = ++element_tag;
+									   element[1] = ( face<0 ? int(cell->material_id()) : int(cell->face(face)->boundary_id()) );
+									   element[2] = ( manifold_id==numbers::flat_manifold_id ? 1 : int(manifold_id)+2 );
+									  const unsigned int n_nodes = ( face<0 ? GeometryInfo<dim>::vertices_per_cell : GeometryInfo<dim>::vertices_per_face );
+									  for ( unsigned int v=0; v<n_nodes; ++v )
+										  element[3+v] = node_tag[ face<0 ? cell->vertex_index(gmsh_vertex_order[v])
+																		  : cell->face(face)->vertex_index(gmsh_vertex_order[v]) ];
+									  out.write( reinterpret_cast<const char*>(header), 3*sizeof(int) );
+									  out.write( reinterpret_cast<const char*>(element), (3+n_nodes)*sizeof(int) );
+								  } );
+		 out << "\n$EndElements\n";
+	}
+
+	/**
+	 * Quality measures of a cell, evaluated at the vertices of its (bi-/tri-)linear geometry
+	 */
+	struct CellQuality
+	{
+		// Smallest determinant of the Jacobian at the corners (negative for an inverted cell)
+		 double min_jacobian = 0.;
+		// Smallest determinant of the Jacobian at the corners divided by the lengths of the edges at the corner,
+		// 1 for a rectangle/cuboid, zero or negative for a degenerated or inverted cell
+		 double min_scaled_jacobian = 0.;
+		// Longest edge divided by the shortest edge
+		 double aspect_ratio = 0.;
+		// Largest |cos| of the angles between the edges at a corner, 0 for a rectangle/cuboid and 1 for a collapsed corner
+		 double skewness = 0.;
+	};
+
+	template<int dim>
+	CellQuality get_cell_quality ( const typename Triangulation<dim>::active_cell_iterator &cell )
+	{
+		CellQuality quality;
+		quality.min_jacobian = std::numeric_limits<double>::max();
+		quality.min_scaled_jacobian = std::numeric_limits<double>::max();
+
+		// The edges of the reference cell connect the vertices whose (lexicographic) index only differs in a single bit
+		 double min_edge = std::numeric_limits<double>::max();
+		 double max_edge = 0.;
+		 for ( unsigned int v=0; v<GeometryInfo<dim>::vertices_per_cell; v++ )
+		 {
+			Tensor<2,dim> jacobian;
+			double edge_lengths[dim];
+			for ( unsigned int d=0; d<dim; d++ )
+			{
+				// Edge at the corner in the direction of the reference coordinate d (oriented, so the Jacobian of a valid cell is positive)
+				 const unsigned int v_lower = v & ~(1u<<d);
+				 const unsigned int v_upper = v | (1u<<d);
+				 const Tensor<1,dim> edge = cell->vertex(v_upper) - cell->vertex(v_lower);
+				 for ( unsigned int i=0; i<dim; i++ )
+					 jacobian[i][d] = edge[i];
+				 edge_lengths[d] = edge.norm();
+				 min_edge = std::min( min_edge, edge_lengths[d] );
+				 max_edge = std::max( max_edge, edge_lengths[d] );
+			}
+
+			const double det_J = determinant( jacobian );
+			double edge_length_product = 1.;
+			for ( unsigned int d=0; d<dim; d++ )
+				edge_length_product *= edge_lengths[d];
+
+			quality.min_jacobian = std::min( quality.min_jacobian, det_J );
+			quality.min_scaled_jacobian = std::min( quality.min_scaled_jacobian, ( edge_length_product>0. ? det_J/edge_length_product : 0. ) );
+
+			for ( unsigned int d1=0; d1<dim; d1++ )
+				for ( unsigned int d2=d1+1; d2<dim; d2++ )
+					if ( edge_lengths[d1]>0. && edge_lengths[d2]>0. )
+					{
+						double dot_product = 0.;
+						for ( unsigned int i=0; i<dim; i++ )
+							dot_product += jacobian[i][d1] * jacobian[i][d2];
+						quality.skewness = std::max( quality.skewness, std::abs(dot_product) / (edge_lengths[d1]*edge_lengths[d2]) );
+					}
+					else
+						quality.skewness = 1.;
+		 }
+		quality.aspect_ratio = ( min_edge>0. ? max_edge/min_edge : std::numeric_limits<double>::infinity() );
+
+		return quality;
+	}
+
+	/**
+	 * Quality report of a mesh, e.g. after notching or shifting vertices (notch_body, prepare_tria_for_notching, shift_vertex_layer,
+	 * element distortion), to detect badly distorted cells before a long solve. \n
+	 * The quality of the locally owned cells is evaluated in parallel (\a get_cell_quality), afterwards we build the histograms
+	 * of the scaled Jacobian, the aspect ratio and the skewness and keep the \a n_worst_cells cells with the smallest scaled Jacobian.
+	 * On a distributed triangulation the cell counts, histograms and extreme values are summed/reduced over all processes,
+	 * whereas the list of worst cells only contains the locally owned cells of this process.
+	 */
+	template<int dim>
+	class MeshQualityReport
+	{
+	public:
+		struct WorstCell
+		{
+			std::string cell_id;
+			Point<dim> center;
+			CellQuality quality;
+		};
+
+		MeshQualityReport ( const Triangulation<dim> &triangulation, const unsigned int n_worst_cells=10 )
+		:
+		histogram_scaled_jacobian(10,0),
+		histogram_aspect_ratio(aspect_ratio_bounds.size()+1,0),
+		histogram_skewness(10,0)
+		{
+			std::vector< typename Triangulation<dim>::active_cell_iterator > cells;
+			cells.reserve( triangulation.n_active_cells() );
+			for ( typename Triangulation<dim>::active_cell_iterator
+				  cell = triangulation.begin_active();
+				  cell != triangulation.end(); ++cell )
+				if ( cell->is_locally_owned() )
+					cells.push_back( cell );
+
+			// Each cell is evaluated independently and writes only its own entry
+			 std::vector<CellQuality> qualities ( cells.size() );
+			 parallel::apply_to_subranges( 0u, static_cast<unsigned int>(cells.size()),
+										   [&] ( const unsigned int begin, const unsigned int end )
+										   {
+											   for ( unsigned int c=begin; c<end; c++ )
+												   qualities[c] = get_cell_quality<dim>( cells[c] );
+										   },
+										   /*grainsize*/ 256 );
+
+			worst.min_jacobian = std::numeric_limits<double>::max();
+			worst.min_scaled_jacobian = std::numeric_limits<double>::max();
+			for ( unsigned int c=0; c<qualities.size(); c++ )
+			{
+				const CellQuality &quality = qualities[c];
+				worst.min_jacobian = std::min( worst.min_jacobian, quality.min_jacobian );
+				worst.min_scaled_jacobian = std::min( worst.min_scaled_jacobian, quality.min_scaled_jacobian );
+				worst.aspect_ratio = std::max( worst.aspect_ratio, quality.aspect_ratio );
+				worst.skewness = std::max( worst.skewness, quality.skewness );
+				if ( quality.min_jacobian <= 0. )
+					n_invalid_cells += 1;
+
+				histogram_scaled_jacobian[ get_bin( (quality.min_scaled_jacobian+1.)/2., histogram_scaled_jacobian.size() ) ] += 1;
+				histogram_skewness[ get_bin( quality.skewness, histogram_skewness.size() ) ] += 1;
+				histogram_aspect_ratio[ std::upper_bound( aspect_ratio_bounds.begin(), aspect_ratio_bounds.end(), quality.aspect_ratio ) - aspect_ratio_bounds.begin() ] += 1;
+			}
+			n_cells = cells.size();
+
+			// The worst cells of this process
+			 std::vector<unsigned int> order ( cells.size() );
+			 for ( unsigned int c=0; c<order.size(); c++ )
+				 order[c] = c;
+			 const unsigned int n_worst = std::min( n_worst_cells, static_cast<unsigned int>(cells.size()) );
+			 std::partial_sort( order.begin(), order.begin()+n_worst, order.end(),
+								[&qualities] ( const unsigned int a, const unsigned int b )
+								{ return qualities[a].min_scaled_jacobian < qualities[b].min_scaled_jacobian; } );
+			 for ( unsigned int i=0; i<n_worst; i++ )
+			 {
+				 WorstCell worst_cell;
+				 worst_cell.cell_id = cells[order[i]]->id().to_string();
+				 worst_cell.center = cells[order[i]]->center();
+				 worst_cell.quality = qualities[order[i]];
+				 worst_cells.push_back( worst_cell );
+			 }
+
+			if ( is_distributed(triangulation) )
+			{
+				const MPI_Comm &mpi_communicator = triangulation.get_communicator();
+				n_cells = Utilities::MPI::sum( n_cells, mpi_communicator );
+				n_invalid_cells = Utilities::MPI::sum( n_invalid_cells, mpi_communicator );
+				Utilities::MPI::sum( histogram_scaled_jacobian, mpi_communicator, histogram_scaled_jacobian );
+				Utilities::MPI::sum( histogram_aspect_ratio, mpi_communicator, histogram_aspect_ratio );
+				Utilities::MPI::sum( histogram_skewness, mpi_communicator, histogram_skewness );
+				worst.min_jacobian = Utilities::MPI::min( worst.min_jacobian, mpi_communicator );
+				worst.min_scaled_jacobian = Utilities::MPI::min( worst.min_scaled_jacobian, mpi_communicator );
+				worst.aspect_ratio = Utilities::MPI::max( worst.aspect_ratio, mpi_communicator );
+				worst.skewness = Utilities::MPI::max( worst.skewness, mpi_communicator );
+			}
+		}
+
+		void print ( std::ostream &out, const std::string &numEx_name="numEx" ) const
+		{
+			out << "numEx<< Mesh quality of " << numEx_name << ": " << n_cells << " cells, " << n_invalid_cells << " degenerated or inverted" << std::endl;
+			out << "numEx<<   min Jacobian " << worst.min_jacobian << ", min scaled Jacobian " << worst.min_scaled_jacobian
+				<< ", max aspect ratio " << worst.aspect_ratio << ", max skewness " << worst.skewness << std::endl;
+
+			out << "numEx<<   scaled Jacobian:";
+			for ( unsigned int i=0; i<histogram_scaled_jacobian.size(); i++ )
+				out << " [" << -1.+2.*i/histogram_scaled_jacobian.size() << "," << -1.+2.*(i+1)/histogram_scaled_jacobian.size() << "):" << histogram_scaled_jacobian[i];
+			out << std::endl;
+
+			out << "numEx<<   aspect ratio:";
+			for ( unsigned int i=0; i<histogram_aspect_ratio.size(); i++ )
+			{
+				out << " [" << ( i==0 ? 1. : aspect_ratio_bounds[i-1] ) << ",";
+				if ( i<aspect_ratio_bounds.size() )
+					out << aspect_ratio_bounds[i];
+				else
+					out << "inf";
+				out << "):" << histogram_aspect_ratio[i];
+			}
+			out << std::endl;
+
+			out << "numEx<<   skewness:";
+			for ( unsigned int i=0; i<histogram_skewness.size(); i++ )
+				out << " [" << double(i)/histogram_skewness.size() << "," << double(i+1)/histogram_skewness.size() << "):" << histogram_skewness[i];
+			out << std::endl;
+
+			out << "numEx<<   worst cells (id, center, min Jacobian, min scaled Jacobian, aspect ratio, skewness):" << std::endl;
+			for ( unsigned int i=0; i<worst_cells.size(); i++ )
+				out << "numEx<<     " << worst_cells[i].cell_id << " (" << worst_cells[i].center << ") " << worst_cells[i].quality.min_jacobian
+					<< " " << worst_cells[i].quality.min_scaled_jacobian << " " << worst_cells[i].quality.aspect_ratio
+					<< " " << worst_cells[i].quality.skewness << std::endl;
+		}
+
+		// Upper bounds of the bins of the aspect ratio histogram (declared first, because the histogram is sized by it)
+		 const std::vector<double> aspect_ratio_bounds = {1.5, 2., 3., 5., 10., 20., 50., 100.};
+
+		unsigned int n_cells = 0;
+		// Number of cells with a zero or negative Jacobian at a corner
+		 unsigned int n_invalid_cells = 0;
+		// Extreme values over all cells (smallest Jacobians, largest aspect ratio and skewness)
+		 CellQuality worst;
+		// Histograms: scaled Jacobian in 10 bins over [-1,1], the aspect ratio split at the \a aspect_ratio_bounds, skewness in 10 bins over [0,1]
+		 std::vector<unsigned int> histogram_scaled_jacobian;
+		 std::vector<unsigned int> histogram_aspect_ratio;
+		 std::vector<unsigned int> histogram_skewness;
+		// The cells with the smallest scaled Jacobian (of this process), worst first
+		 std::vector<WorstCell> worst_cells;
+
+	private:
+		static unsigned int get_bin ( const double value_0_1, const unsigned int n_bins )
+		{
+			const int bin = static_cast<int>( std::floor( value_0_1 * n_bins ) );
+			return static_cast<unsigned int>( std::max( 0, std::min( int(n_bins)-1, bin ) ) );
+		}
+	};
+
+	template<int dim>
+	void output_triangulation ( const Triangulation<dim> &triangulation, const unsigned int output_type=enums::output_eps, const std::string numEx_name="numEx" )
+	{
+		std::cout << "numEx<< Writting triangulation to output ..." << std::endl;
+		std::ostringstream filename;
+		switch ( output_type )
+		{
+			case enums::output_eps:
+			{
+				filename << "grid-" << numEx_name << ".eps";
+				std::ofstream out (filename.str().c_str()); // @todo-optimize That should be simpler?!
+				GridOut grid_out;
+				grid_out.write_eps (triangulation, out);
+				break;
+			}
+			case enums::output_inp:
+			{
+				filename << "grid-" << numEx_name << ".inp";
+				std::ofstream out_ucd(filename.str().c_str());
+				GridOut grid_out;
+				GridOutFlags::Ucd ucd_flags(true,true,true);
+				grid_out.set_flags(ucd_flags);
+				grid_out.write_ucd(triangulation, out_ucd);
+				break;
+			}
+			case enums::output_vtu:
+			case enums::output_vtu_zlib:
+			{
+				filename << "grid-" << numEx_name;
+				write_vtu_binary( triangulation, filename.str(), /*compress*/ output_type==enums::output_vtu_zlib );
+				filename << ( (triangulation.locally_owned_subdomain()==numbers::invalid_subdomain_id) ? ".vtu" : ".pvtu" );
+				break;
+			}
+			case enums::output_msh:
+			{
+				filename << "grid-" << numEx_name;
+				write_msh_binary( triangulation, filename.str() );
+				filename << ".msh";
+				break;
+			}
+			case enums::output_quality:
+			{
+				filename << "grid-" << numEx_name << "-quality.txt";
+				const MeshQualityReport<dim> quality_report ( triangulation );
+				quality_report.print( std::cout, numEx_name );
+				if ( !is_distributed(triangulation) || Utilities::MPI::this_mpi_process(triangulation.get_communicator())==0 )
+				{
+					std::ofstream out (filename.str().c_str());
+					quality_report.print( out, numEx_name );
+				}
+				break;
+			}
+			default:
+				AssertThrow(false, ExcMessage(numEx_name+" - output_triangulation<< You choose a not implemented output type, try eps, inp, vtu, vtu_zlib, msh or quality instead."));
+		}
+		std::cout << "numEx<< ... grid written to " << filename.str().c_str() << std::endl;
+	}
+
+	
+	/**
+	 * Shift a layer of vertices of the triangulation at the coord position \a initial_pos to the position \a new_pos
+	 * @param direction Gives the shift direction 0(x), 1(y), 2(z)
+	 * @note Use this overload with the same \a vertex_index for a sequence of shifts on an unchanged triangulation,
+	 * so the unique vertices only need to be gathered once.
+	 */
+	template <int dim>
+	void shift_vertex_layer( VertexIndex<dim> &vertex_index, const double &initial_pos, const double &new_pos, const unsigned int direction )
+	{
+		const unsigned int n_shifted_nodes = transform_vertices( vertex_index,
+																 [&] ( Point<dim> &vertex )
+																 {
+																	 if ( std::abs( vertex[direction] - initial_pos) < 1e-12/*search_tolerance*/ )
+																	 {
+																		 vertex[direction] += (new_pos-initial_pos);
+																		 return true;
+																	 }
+																	 return false;
+																 } );
+		// Ensure that we shifted at least a single node
+		 AssertThrow( n_shifted_nodes>0, ExcMessage("shift_vertex_layer<< You haven't moved a single node. Please check the selection criterion initial_pos "
+				 	 	 	 	 	 	 	 	 	 +std::to_string(initial_pos)+" vs your new_pos "+std::to_string(new_pos)+"."));
+	}
+
+	template <int dim>
+	void shift_vertex_layer( Triangulation<dim> &triangulation, double &initial_pos, double &new_pos, unsigned int direction )
+	{
+		VertexIndex<dim> vertex_index ( triangulation );
+		shift_vertex_layer( vertex_index, initial_pos, new_pos, direction );
+	}
+
+
+	/**
+	 * Split the \a repetitions of a set of subdivided bricks into the coarse repetitions \a coarse_repetitions and a number of global
+	 * refinements (return value). The refined coarse bricks have at least as many elements as the given \a repetitions in every direction,
+	 * but at most (1+max_overshoot) times as many. Out of these options we take the one with the most refinements.
+	 * By default (zero \a max_overshoot) the resolution stays exactly the same, so the repetitions are only divided by the largest power
+	 * of two that divides all of them, e.g. (12,6) become (2,1) with two refinements. A direction with a single element (e.g. one element
+	 * over the thickness) or an odd number of elements cannot be coarsened and thus prevents any refinement.
+	 * A positive \a max_overshoot allows to round up the repetitions, e.g. (6,3) become (2,1) with two refinements, so the refined brick
+	 * has (8,4) elements. In this case, we print the directions whose resolution deviates.
+	 * @note All bricks get the same number of refinements and equal repetitions result in equal coarse repetitions, so bricks with
+	 * identically meshed interfaces still match after the coarsening.
+	 */
+	inline unsigned int get_minimal_coarse_repetitions ( const std::vector< std::vector<unsigned int> > &repetitions,
+														 std::vector< std::vector<unsigned int> > &coarse_repetitions,
+														 const double max_overshoot=0. )
+	{
+		unsigned int n_refinements = 0;
+		coarse_repetitions = repetitions;
+
+		// Try more and more refinements until all bricks are reduced to a single coarse cell, because from then on
+		// each further refinement only doubles the overshoot
+		 bool single_coarse_cells = false;
+		 for ( unsigned int n_trial=1; n_trial<32 && !single_coarse_cells; n_trial++ )
+		 {
+			 const unsigned int factor = 1u << n_trial;
+			 std::vector< std::vector<unsigned int> > trial_repetitions = repetitions;
+
+			 bool accepted = true;
+			 single_coarse_cells = true;
+			 for ( unsigned int brick=0; brick<repetitions.size(); brick++ )
+				 for ( unsigned int d=0; d<repetitions[brick].size(); d++ )
+				 {
+					 AssertThrow( repetitions[brick][d]>0, ExcMessage("get_minimal_coarse_repetitions<< Each brick needs at least one element in each direction."));
+
+					 trial_repetitions[brick][d] = ( repetitions[brick][d] + factor - 1 ) / factor;
+					 if ( trial_repetitions[brick][d] * factor > (1.+max_overshoot) * repetitions[brick][d] )
+						 accepted = false;
+					 if ( trial_repetitions[brick][d] > 1 )
+						 single_coarse_cells = false;
+				 }
+
+			 if ( accepted )
+			 {
+				 n_refinements = n_trial;
+				 coarse_repetitions = trial_repetitions;
+			 }
+		 }
+
+		// Report the directions, in which the rounding changed the resolution
+		 for ( unsigned int brick=0; brick<repetitions.size(); brick++ )
+			 for ( unsigned int d=0; d<repetitions[brick].size(); d++ )
+				 if ( ( coarse_repetitions[brick][d] << n_refinements ) != repetitions[brick][d] )
+					 std::cout << "numEx<< get_minimal_coarse_repetitions: brick " << brick << " has " << ( coarse_repetitions[brick][d] << n_refinements )
+							   << " instead of " << repetitions[brick][d] << " elements in direction " << d << "." << std::endl;
+
+		return n_refinements;
+	}
+
+
+	/**
+	 * Create the subdivided bricks spanned by the point pairs \a brick_corners with the given \a repetitions and merge them into the
+	 * empty \a triangulation. For \a minimal_coarse_mesh the bricks are instead created with the coarse repetitions from
+	 * \a get_minimal_coarse_repetitions and the merged triangulation is refined globally to reach the resolution. This yields
+	 * the same mesh, but with only a few level-0 cells and a deep level hierarchy as needed by geometric multigrid.
+	 * @return The number of global refinements applied to the merged bricks (zero for the flat mesh)
+	 * @note The interfaces between the bricks need to be meshed identically, deal.II cannot detect hanging nodes there.
+	 */
+	template<int dim>
+	unsigned int create_merged_bricks ( Triangulation<dim> &triangulation,
+										const std::vector< std::pair< Point<dim>,Point<dim> > > &brick_corners,
+										const std::vector< std::vector<unsigned int> > &repetitions,
+										const double merge_tolerance, const bool minimal_coarse_mesh=false )
+	{
+		AssertThrow( brick_corners.size()==repetitions.size() && !brick_corners.empty(),
+					 ExcMessage("create_merged_bricks<< Every brick needs its corner points and its repetitions."));
+
+		std::vector< std::vector<unsigned int> > brick_repetitions = repetitions;
+		unsigned int n_refinements = 0;
+		if ( minimal_coarse_mesh )
+		{
+			n_refinements = get_minimal_coarse_repetitions( repetitions, brick_repetitions );
+			AssertThrow( n_refinements>0, ExcMessage("create_merged_bricks<< The minimal coarse mesh would be the flat mesh, because the repetitions "
+													 "of the bricks are not all divisible by two (e.g. a single element over the thickness). "
+													 "Please use even repetitions or the flat mesh."));
+		}
+
+		std::vector< std::unique_ptr< Triangulation<dim> > > bricks;
+		std::vector< const Triangulation<dim>* > brick_pointers;
+		for ( unsigned int brick=0; brick<brick_corners.size(); brick++ )
+		{
+			bricks.emplace_back( new Triangulation<dim> );
+			GridGenerator::subdivided_hyper_rectangle ( *bricks.back(),
+														brick_repetitions[brick],
+														brick_corners[brick].first,
+														brick_corners[brick].second );
+			brick_pointers.push_back( bricks.back().get() );
+		}
+
+		if ( bricks.size()==1 )
+			triangulation.copy_triangulation( *bricks[0] );
+		else
+			GridGenerator::merge_triangulations( brick_pointers, triangulation, merge_tolerance );
+
+		triangulation.refine_global( n_refinements );
+
+		return n_refinements;
+	}
+
+
+	/**
+	 * Repeated local refinements of a region that shrinks (or stays the same) with each refinement level, e.g. a damage band or the cells
+	 * at a plane. Instead of scanning all active cells in each level, only the active children of the cells refined in the previous
+	 * level are tested. So the (possibly expensive) selection is only evaluated in the refined region instead of the entire mesh.
+	 * @note This requires that a cell that was not selected on one level is also not selected on the next level. Cells that the
+	 * triangulation additionally refines to limit the number of hanging nodes are found among the cells that share a vertex with
+	 * the refined cells, so in 3D also the cells that only share an edge are found.
+	 * @note A distributed triangulation is repartitioned during the refinement, so there we have to fall back to all active cells.
+	 * Only the locally owned cells are selected there, the refinement of the ghost cells is done by their owners.
+	 */
+	template<int dim>
+	class RefinementRegion
+	{
+	public:
+		RefinementRegion ( Triangulation<dim> &triangulation )
+		:
+		tria(&triangulation)
+		{
+			reset();
+		}
+
+		/**
+		 * Use all active cells as candidates again, e.g. for a region that is not contained in the previous one
+		 */
+		void reset ()
+		{
+			candidates.clear();
+			candidates.reserve( tria->n_active_cells() );
+			for ( typename Triangulation<dim>::active_cell_iterator
+				  cell = tria->begin_active();
+				  cell != tria->end(); ++cell )
+				candidates.push_back( cell );
+		}
+
+		/**
+		 * Refine all candidate cells for which \a select_cell(cell) returns true with the \a refinement_case.
+		 * Afterwards, the children of the refined cells are the candidates of the next call.
+		 * @return The number of cells that were selected
+		 */
+		template<typename SelectorType>
+		unsigned int refine ( const SelectorType &select_cell,
+							  const RefinementCase<dim> &refinement_case=RefinementCase<dim>::isotropic_refinement )
+		{
+			std::vector< typename Triangulation<dim>::cell_iterator > refined_cells;
+			for ( unsigned int i=0; i<candidates.size(); i++ )
+				if ( candidates[i]->is_locally_owned() && select_cell( candidates[i] ) )
+				{
+					candidates[i]->set_refine_flag( refinement_case );
+					refined_cells.push_back( candidates[i] );
+				}
+			const unsigned int n_selected_cells = refined_cells.size();
+
+			if ( is_distributed(*tria) )
+			{
+				tria->execute_coarsening_and_refinement();
+				reset();
+			}
+			else
+			{
+				// Find the cells that are flagged additionally by the triangulation, starting from the selected cells.
+				// Faces are not enough, because in 3D also the cells at a refined edge are flagged.
+				 tria->prepare_coarsening_and_refinement();
+				 const std::vector< std::set< typename Triangulation<dim>::active_cell_iterator > > vertex_to_cells
+					 = GridTools::vertex_to_cell_map( *tria );
+				 std::set< typename Triangulation<dim>::cell_iterator > visited ( refined_cells.begin(), refined_cells.end() );
+				 for ( unsigned int i=0; i<refined_cells.size(); i++ )
+					 for ( unsigned int vertex=0; vertex<GeometryInfo<dim>::vertices_per_cell; ++vertex )
+						 for ( const typename Triangulation<dim>::active_cell_iterator &neighbor : vertex_to_cells[ refined_cells[i]->vertex_index(vertex) ] )
+							 if ( neighbor->refine_flag_set() && visited.insert(neighbor).second )
+								 refined_cells.push_back( neighbor );
+
+				tria->execute_coarsening_and_refinement();
+
+				candidates.clear();
+				for ( unsigned int i=0; i<refined_cells.size(); i++ )
+					for ( unsigned int child=0; child<refined_cells[i]->n_children(); ++child )
+						if ( refined_cells[i]->child(child)->is_active() )
+							candidates.push_back( refined_cells[i]->child(child) );
+			}
+
+			return n_selected_cells;
+		}
+
+		/**
+		 * @return The number of cells that are tested in the next call of \a refine
+		 */
+		unsigned int n_candidates () const
+		{
+			return candidates.size();
+		}
+
+	private:
+		Triangulation<dim> *tria;
+		std::vector< typename Triangulation<dim>::active_cell_iterator > candidates;
+	};
+
+	template <int dim>
+	class BeamEnd : public Function<dim>
+	{
+	public:
+		BeamEnd ( const double &length0, const double &height0, const double &lambda_n, const double &current_load_increment, const unsigned int &n_components )
+		:
+			Function<dim>(n_components),
+			l_0(length0),
+			h_0(height0),
+			theta_n(lambda_n),
+			incr(current_load_increment),
+			n_comp(n_components)
+		{
+			set_load_state( lambda_n, current_load_increment );
+		}
+		virtual ~BeamEnd() {};
+
+		double l_0, h_0;
+		double theta_n;
+		double incr;
+		unsigned int n_comp;
+
+		/**
+		 * Set the rotation \a lambda_n at the beginning of the load step and its \a current_load_increment.
+		 * The displacement increment is affine in the y-coordinate of the point, so we evaluate all the sin and cos terms
+		 * once here (instead of at every support point) and store the constant part and the slope.
+		 */
+		void set_load_state ( const double &lambda_n, const double &current_load_increment )
+		{
+			theta_n = lambda_n;
+			incr = current_load_increment;
+
+			Tensor<1,2> u_m_n;
+			u_m_n[enums::x] = l_0 * ( std::sin(theta_n+1e-10)/(theta_n+1e-10) - 1.);
+			u_m_n[enums::y] = l_0 * ( std::cos(theta_n+1e-10)/(theta_n+1e-10) - 1./(theta_n+1e-10));
+
+			const double theta_n1 = theta_n + incr;
+			Tensor<1,2> u_m_n1;
+			u_m_n1[enums::x] = l_0 * ( std::sin(theta_n1+1e-10)/(theta_n1+1e-10) - 1.);
+			u_m_n1[enums::y] = l_0 * ( std::cos(theta_n1+1e-10)/(theta_n1+1e-10) - 1./(theta_n1+1e-10));
+
+			// u_n1 - u_n = (u_m_n1 - u_m_n) + (p_y-h_0/2) * ( rotation terms at n1 - rotation terms at n )
+			 increment_constant[enums::x] = u_m_n1[enums::x] - u_m_n[enums::x];
+			 increment_constant[enums::y] = u_m_n1[enums::y] - u_m_n[enums::y];
+			 increment_slope[enums::x] = std::sin(theta_n1) - std::sin(theta_n);
+			 increment_slope[enums::y] = std::cos(theta_n1) - std::cos(theta_n);
+		}
+
+		// return all components at one point
+		virtual void vector_value(const Point<dim> &p, Vector<double>   &value) const
+		{
+			const double y_rel = p[enums::y] - h_0/2.;
+			value = 0;
+			for ( unsigned int i=0; i<2; i++)
+				value[i] = increment_constant[i] + y_rel * increment_slope[i];
+		}
+
+		// return all components at all the points (e.g. all support points on the clamped end at once)
+		virtual void vector_value_list(const std::vector<Point<dim> > &points, std::vector<Vector<double> > &values) const
+		{
+			const unsigned int n_points = points.size();
+			AssertDimension( values.size(), n_points );
+
+			// Process the points in blocks: gather the y-coordinates and evaluate both components in plain loops
+			// over small arrays on the stack, which the compiler can vectorise
+			 const unsigned int block_size = 8;
+			 double y_rel[block_size], u_x[block_size], u_y[block_size];
+			 for ( unsigned int q0=0; q0<n_points; q0+=block_size )
+			 {
+				 const unsigned int n_block = std::min( block_size, n_points-q0 );
+				 for ( unsigned int q=0; q<n_block; q++ )
+					 y_rel[q] = points[q0+q][enums::y] - h_0/2.;
+				 for ( unsigned int q=0; q<n_block; q++ )
+				 {
+					 u_x[q] = increment_constant[enums::x] + y_rel[q] * increment_slope[enums::x];
+					 u_y[q] = increment_constant[enums::y] + y_rel[q] * increment_slope[enums::y];
+				 }
+				 for ( unsigned int q=0; q<n_block; q++ )
+				 {
+					 values[q0+q] = 0;
+					 values[q0+q][enums::x] = u_x[q];
+					 values[q0+q][enums::y] = u_y[q];
+				 }
+			 }
+		}
+
+	private:
+		// Constant part and slope (w.r.t. the y-coordinate) of the displacement increment
+		 Tensor<1,2> increment_constant;
+		 Tensor<1,2> increment_slope;
+
+//		virtual double value (const Point<dim>   &p,
+//							const unsigned int   = 0) const override final
+//		{
+//			double val = 1.;
+//			SymmetricTensor<2,2> stress_tensor_dummy;
+//			Point<dim> point_xy = p;
+//			get_KIRSCH_stresses( point_xy, current_load, nu, stress_tensor_dummy, val);// 0929 stress_vonMises );
+//			return val;
+//		}
+	};
+
+
+	/**
+	 * @todo-optimize Use deal.II object information to get normal and tangent for the face
+	 */
+	template <int dim>
+	class NotchClass
+	{
+	public:
+		// Linear notch
+		NotchClass ( const unsigned int notch_type, const double &notch_length, const double &notch_depth, const Point<3> &notch_reference_point, 
+					 const types::boundary_id &notch_face_BID, const Point<3> &face_normal_vector, const unsigned int notch_tangent_dir )
+		:
+		type(notch_type),
+		length(notch_length),
+		depth(notch_depth),
+		ref_pos(notch_reference_point),
+		face_BID(notch_face_BID),
+		normal_vector(face_normal_vector),
+		tangent_dir(notch_tangent_dir)
+		{
+		}
+		
+		// Round notch
+		NotchClass ( const unsigned int notch_type, const double &notch_length, const double &notch_depth, const Point<3> &notch_reference_point,
+					 const types::boundary_id &notch_face_BID, const Point<3> &face_normal_vector, const unsigned int notch_tangent_dir,
+					 const types::manifold_id &notch_manifold_id )
+		:
+		type(notch_type),
+		length(notch_length),
+		depth(notch_depth),
+		ref_pos(notch_reference_point),
+		face_BID(notch_face_BID),
+		normal_vector(face_normal_vector),
+		tangent_dir(notch_tangent_dir),
+		manifold_id(notch_manifold_id)
+		{
+			 radius = ( std::pow(notch_length/2.,2) + notch_depth*notch_depth ) / ( 2. * notch_depth );
+			 cyl_center = notch_reference_point;
+			 cyl_center += face_normal_vector * (radius - notch_depth);
+		}
+		
+		// @todo Maybe also some constructors and functions in case we get the center point, etc.
+		
+		unsigned int type;
+		double length;
+		double depth;
+		Point<3> ref_pos;
+		types::boundary_id face_BID;
+		Point<3> normal_vector;
+		unsigned int tangent_dir;
+		double radius = 0.;
+		types::manifold_id manifold_id;
+		Point<3> cyl_center;
+	};
+	
+	double get_current_notch_radius( const unsigned int notch_type, double &y_coord, const double &half_notch_length, const double &radius, const double &notch_radius, const double &R  )
+	{
+		switch ( notch_type )
+		{
+			case enums::notch_round:
+				return R + notch_radius - std::sqrt( R*R - y_coord*y_coord );
+			case enums::notch_linear:
+				return y_coord/half_notch_length * (radius-notch_radius) + notch_radius;
+			default:
+				AssertThrow(false, ExcMessage("numEx - << notch type not implemented"));
+				return 0;
+		}
+	}
+	
+	template<int dim>
+	double get_notching ( const NotchClass<dim> &notch, const double &delta_y )
+	{
+		switch ( notch.type )
+		{
+			case enums::notch_round:
+				return std::sqrt( notch.radius*notch.radius - delta_y*delta_y ) - ( notch.radius - notch.depth );
+			case enums::notch_linear:
+				return notch.depth * ( 1. - delta_y / (notch.length/2.) );
+			default:
+				AssertThrow(false, ExcMessage("numEx - get_notching<< notch type not implemented"));
+				return 0;
+		}
+	}
+
+	
+	/**
+	 * Notch the body along the face with the boundary id of the \a notch
+	 * @param boundary_vertex_index Index over the boundary vertices of the \a triangulation, which can be shared
+	 * with \a prepare_tria_for_notching and further notches on the same triangulation
+	 */
+	template<int dim>
+	void notch_body ( Triangulation<dim> &triangulation, const NotchClass<dim> &notch, VertexIndex<dim> &boundary_vertex_index )
+	{
+		if ( /*soft notch*/true )
+		{
+			// Collect the vertices on the notched face (boundary faces only) in a bitset indexed by the global vertex index
+			 std::vector<bool> notch_vertices ( triangulation.n_vertices(), false );
+			 for (typename Triangulation<dim>::active_cell_iterator
+			   cell = triangulation.begin_active();
+			   cell != triangulation.end(); ++cell)
+			 {
+				  for (unsigned int face=0; face < GeometryInfo<dim>::faces_per_cell; ++face)
+					  if ( cell->face(face)->at_boundary() && cell->face(face)->boundary_id()==notch.face_BID )
+						  for (unsigned int vertex=0; vertex < GeometryInfo<dim>::vertices_per_face; ++vertex)
+						  {
+							  // Distance from the given vertex to the reference point \a POS of the notch. We can directly
+							  // use the absolute value because the notch is symmetric
+							   double distance_vertex2POS = std::abs( cell->face(face)->vertex(vertex)[notch.tangent_dir] - notch.ref_pos[notch.tangent_dir] );
+							  // We can use "less than" without equal, because we woud do nothing for the corner points anyway.
+							  // This might also avoid spreading of the manifold to an outer cell's face.
+							   if ( distance_vertex2POS < notch.length/2. )
+							   {
+								  notch_vertices[ cell->face(face)->vertex_index(vertex) ] = true;
+
+								  // Assign cylindrical manifold for round notches. We also have to do this for faces
+								  // whose vertices are shared with a neighbouring cell's face, because each face needs the correct manifold id.
+								   if ( notch.type == enums::notch_round )
+										cell->face(face)->set_all_manifold_ids(notch.manifold_id);
+							   } // end if(to be shifted)
+						  } // end for(vertex)
+			 } // end for(cell)
+
+			// Shift each collected vertex exactly once inwards via the negative normal vector of the face
+			// @note The notching only depends on the tangential coordinate, which is not changed by the shift.
+			 transform_vertices( boundary_vertex_index,
+								 [&] ( Point<dim> &vertex )
+								 {
+									 const double distance_vertex2POS = std::abs( vertex[notch.tangent_dir] - notch.ref_pos[notch.tangent_dir] );
+									 // Compute the absolute value we need to move the vertex inside
+									  const double notching = get_notching( notch, distance_vertex2POS );
+									 vertex -= notching * extract_dim<dim>( notch.normal_vector );
+									 return true;
+								 },
+								 notch_vertices );
+		}
+	}
+
+	template<int dim>
+	void notch_body ( Triangulation<dim> &triangulation, const NotchClass<dim> &notch )
+	{
+		VertexIndex<dim> boundary_vertex_index ( triangulation, /*only_boundary_vertices*/true );
+		notch_body( triangulation, notch, boundary_vertex_index );
+	}
+
+	
+	/**
+	 * Move the boundary vertices closest to the corner points (and the depth point for linear notches) of the \a notch
+	 * onto these points, so the notch starts and ends exactly at a vertex.
+	 * @param boundary_vertex_index Index over the boundary vertices of the \a triangulation. Keep it alive for several
+	 * notches on the same triangulation, it is only rebuilt when the triangulation was refined in between.
+	 * @todo Think about using this fnc only for 2D and then using extrude_triangulation
+	 */
+	template<int dim>
+	void prepare_tria_for_notching ( Triangulation<dim> &triangulation, const NotchClass<dim> &notch, VertexIndex<dim> &boundary_vertex_index )
+	{
+		// First, we compute the corner points
+		 Point<dim> point_corner_positive = extract_dim<dim>( notch.ref_pos ); 
+		 point_corner_positive[notch.tangent_dir] += notch.length / 2.;
+		
+		 Point<dim> point_corner_negative = extract_dim<dim>( notch.ref_pos ); 
+		 point_corner_negative[notch.tangent_dir] -= notch.length / 2.;
+		 
+		 // The point at the reference point shall be shifted into the body, so we look for
+		 // vertex at this point.
+		 Point<dim> point_corner_depth = extract_dim<dim>( notch.ref_pos );
+
+		// Then, we find the nearest vertex and adapt them to the corner points either locally or globally
+		// We limit the list of vertices only to the vertices at the boundary to reduce the number of vertices
+		// to be tested and to avoid finding vertices inside the body.
+		 const unsigned int vertexID_closest_positive = boundary_vertex_index.find_closest_vertex( point_corner_positive );
+		 const unsigned int vertexID_closest_negative = boundary_vertex_index.find_closest_vertex( point_corner_negative );
+		 const unsigned int vertexID_closest_depth = 	boundary_vertex_index.find_closest_vertex( point_corner_depth );
+
+		switch ( notch.type )
+		{
+			case enums::notch_round:
+				if ( vertexID_closest_positive == vertexID_closest_negative )
+					AssertThrow( false, ExcMessage( "prepare_tria_for_notching<< The two found points closest to the corner points of the notch are identical, "
+													"but need to be different. Use a finer mesh.") );
+				break;
+			case enums::notch_linear:
+				if ( vertexID_closest_positive == vertexID_closest_negative 
+					||  vertexID_closest_depth == vertexID_closest_negative
+					||  vertexID_closest_positive == vertexID_closest_depth )
+					AssertThrow( false, ExcMessage( "prepare_tria_for_notching<< The three found points closest to the corner points of the notch coincident "
+													"partly or fully, but need to be different. Use a finer mesh.") );
+				break;
+		}
+
+		// @todo-extent The following limits the orientations of the notch to the xy-plane
+		// Get the coordinates of the closest vertices directly via their index
+		// @todo We should also check whether the point is reasonably far away.
+		 const Point<dim> vertex_closest_positive = boundary_vertex_index.vertex( vertexID_closest_positive );
+		 const Point<dim> vertex_closest_negative = boundary_vertex_index.vertex( vertexID_closest_negative );
+		 Point<dim> vertex_closest_depth;
+		 if ( notch.type==enums::notch_linear )
+			 vertex_closest_depth = boundary_vertex_index.vertex( vertexID_closest_depth );
+		 
+		// Shift the above vertices and also the ones in the third dimension (same xy-position).
+		// These all lie on the boundary, so we only visit each boundary vertex once.
+		 transform_vertices( boundary_vertex_index,
+							 [&] ( Point<dim> &vertex )
+							 {
+								  Point<dim> vector_to_positive = vertex;
+								  vector_to_positive -= vertex_closest_positive;
+								  double distance2D_to_positive = std::sqrt( vector_to_positive[0]*vector_to_positive[0] + vector_to_positive[1]*vector_to_positive[1] );
+								  Point<dim> vector_to_negative = vertex;
+								  vector_to_negative -= vertex_closest_negative;
+								  double distance2D_to_negative = std::sqrt( vector_to_negative[0]*vector_to_negative[0] + vector_to_negative[1]*vector_to_negative[1] );
+								  Point<dim> vector_to_depth = vertex;
+								  vector_to_depth -= vertex_closest_depth;
+								  double distance2D_to_depth = std::sqrt( vector_to_depth[0]*vector_to_depth[0] + vector_to_depth[1]*vector_to_depth[1] );
+
+								   if ( distance2D_to_positive < 1e-8 )
+								   {
+									   vertex[0] = point_corner_positive[0];
+									   vertex[1] = point_corner_positive[1];
+									   return true;
+								   }
+								   else if ( distance2D_to_negative < 1e-8 )
+								   {
+									   vertex[0] = point_corner_negative[0];
+									   vertex[1] = point_corner_negative[1];
+									   return true;
+								   }
+								   else if ( notch.type==enums::notch_linear && distance2D_to_depth < 1e-8 )
+								   {
+									   vertex[0] = point_corner_depth[0];
+									   vertex[1] = point_corner_depth[1];
+									   return true;
+								   }
+								   return false;
+							 } );
+	}
+
+	template<int dim>
+	void prepare_tria_for_notching ( Triangulation<dim> &triangulation, const NotchClass<dim> &notch )
+	{
+		VertexIndex<dim> boundary_vertex_index ( triangulation, /*only_boundary_vertices*/true );
+		prepare_tria_for_notching( triangulation, notch, boundary_vertex_index );
+	}
+	
+	
+	/**
+	 * @todo Use spherical manifold or sth on coarse mesh and only move a single node in, then do local refinements and all vertices will follow the curvature
+	 * @param triangulation
+	 * @param half_notch_length Half the length of the notch in y-direction. We only model 1/8 of the entire bar, hence only 1/2 of the notch length
+	 * @param notch_radius The radius of the rod that is left at y=0 in the notch
+	 * @param R The radius of the notch corresponds to the tool radius that could be used on a lathe to create the notch.
+	 * @note The new position of a vertex only depends on its old position. On a distributed triangulation every rank
+	 * thus moves its copies of the ghost vertices exactly like the owning rank, so the ghost layers stay consistent.
+	 * However, repartitioning or refining the distributed triangulation afterwards would lose the notch. There, notch the
+	 * coarse mesh and attach the \a NotchedRodManifold instead.
+	 */
+	template <int dim>
+	void notch_body( Triangulation<dim> &triangulation, const double &half_notch_length, const double &radius, const double &notch_radius,
+					 const double &R, const unsigned int notch_type, const bool geom_cylindrical=false, const double offset=0. )
+	{
+		enum enum_coord_directions
+		{
+			x = 0, y = 1, z = 2
+		};
+		const double search_tolerance = 1e-12;
+
+		if ( /*Deep notch: also adapt inner nodes in the notched area*/true )
+		{
+			// Each unique vertex is visited exactly once by the transformation engine
+			 VertexIndex<dim> vertex_index ( triangulation );
+
+			// Generate the notch
+			 transform_vertices( vertex_index,
+								 [&] ( Point<dim> &vertex )
+								 {
+									  // We look for all the points that lie in the notched area (y-coord in half length of notch)
+									   double y_coord = std::abs( offset - vertex[y] );
+									   if ( y_coord < half_notch_length )
+									   {
+										  double x_coord = vertex[x];
+										  double vertex_radius=x_coord, z_coord=0.;
+										  if ( dim==3 && geom_cylindrical )
+										  {
+											  z_coord = vertex[z];
+											  vertex_radius = std::sqrt(x_coord*x_coord + z_coord*z_coord);
+										  }
+
+										  // The radius of the leftover notched material describes an arc along the y-coord.
+										  // Hence, the radius of the notch changes with the y-coord
+										   double current_notch_radius = get_current_notch_radius( notch_type, y_coord, half_notch_length, radius, notch_radius, R );
+										  // Set the shift vector that moves the vertex inwards (along its radius)
+										   Point<dim> shift_vector;
+										   shift_vector[x] = (current_notch_radius - radius) * std::sqrt(vertex_radius/radius) * x_coord/radius;
+										   if ( dim==3 )
+											   shift_vector[z] = (current_notch_radius - radius) * std::sqrt(vertex_radius/radius) * z_coord/radius;
+										  // Apply the shift vector to the vertex
+										   vertex += shift_vector;
+										   return true;
+									   }
+									   return false;
+								 } );
+		}
+		else /*only move the outer nodes of the notch inwards, this is limited to shallow notches and does not distort the inner cells*/
+		{
+			Assert( (radius - notch_radius) < radius/6.,
+					ExcMessage("Rod<< You choose the shallow notching, but your notch seems to be very deep. Consider using the deep notch option above."));
+
+			VertexIndex<dim> vertex_index ( triangulation, /*only_boundary_vertices*/true );
+			transform_vertices( vertex_index,
+								[&] ( Point<dim> &vertex )
+								{
+								  // We look for all the points that lie in the notched area (y-coord in half length of notch)
+								   double y_coord = vertex[y];
+								   if ( y_coord < half_notch_length )
+								   {
+									  double x_coord = vertex[x];
+									  double z_coord = vertex[z];
+									  // Look for point that lies on the outer surface
+									   if ( std::abs( std::sqrt(x_coord*x_coord + z_coord*z_coord) - radius ) < search_tolerance )
+									   {
+										  // The radius of the leftover notched material describes an arc along the y-coord.
+										  // Hence, the radius of the notch changes with the y-coord
+										   double current_notch_radius = R + notch_radius - std::sqrt( R*R - y_coord*y_coord );
+										  // Set the shift vector that moves the vertex inwards
+										   Point<dim> shift_vector;
+										   shift_vector[0] = (current_notch_radius - radius) / radius * x_coord ;
+										   shift_vector[2] = (current_notch_radius - radius) / radius * z_coord;
+										  // Apply the shift vector to the vertex
+										   vertex += shift_vector;
+										   return true;
+									   }
+								   }
+								   return false;
+								} );
+		}
+	}
+
+
+	/**
+	 * Manifold of the rod (axis in y-direction) notched by the deep cylindrical \a notch_body.
+	 * The chart is the rod before notching, the \a push_forward applies the radial shift of \a notch_body and
+	 * the \a pull_back inverts it. So every new vertex is placed where \a notch_body would have moved the
+	 * corresponding vertex of the refined unnotched rod.
+	 * On a distributed triangulation, p4est recreates cells from the coarse mesh on refinement and repartitioning. The manually
+	 * moved vertices are lost then, whereas the manifold places the recreated vertices identically on every rank.
+	 * Hence, notch the coarse mesh with \a notch_body and attach this manifold to all cells.
+	 * @param on_surface Use cylindrical coordinates (radius, angle, y) as chart, so new vertices on the lateral surface follow
+	 * the curvature (as for the CylindricalManifold). Only use this for faces away from the axis.
+	 * @note The shift is only invertible if the notch leaves more than a third of the radius (\a notch_radius > \a radius/3).
+	 */
+	template <int dim>
+	class NotchedRodManifold : public ChartManifold<dim,dim,dim>
+	{
+	public:
+		NotchedRodManifold ( const double half_notch_length, const double radius, const double notch_radius, const double R,
+							 const unsigned int notch_type, const bool on_surface=false, const double offset=0. )
+		:
+		half_notch_length(half_notch_length),
+		radius(radius),
+		notch_radius(notch_radius),
+		R(R),
+		notch_type(notch_type),
+		on_surface(on_surface),
+		offset(offset)
+		{
+			static_assert( dim==3, "numEx - NotchedRodManifold<< The notched rod is only available in 3D.");
+			AssertThrow( notch_radius > radius/3.,
+						 ExcMessage("numEx - NotchedRodManifold<< The notch is too deep to invert the notching, the notch radius must exceed a third of the radius."));
+		}
+
+		virtual std::unique_ptr<Manifold<dim,dim>> clone () const override
+		{
+			return std::unique_ptr<Manifold<dim,dim>>( new NotchedRodManifold<dim>( half_notch_length, radius, notch_radius, R,
+																				 notch_type, on_surface, offset ) );
+		}
+
+		virtual Point<dim> pull_back ( const Point<dim> &space_point ) const override
+		{
+			const double notched_radius = std::sqrt( space_point[x]*space_point[x] + space_point[z]*space_point[z] );
+
+			// The notching only changes the radius, so we solve r + k*r^1.5 = notched_radius for the unnotched radius r.
+			// The left-hand side is concave and increasing, so Newton's method starting at the notched radius converges monotonically.
+			 double unnotched_radius = notched_radius;
+			 const double k = get_shift_factor( space_point[y] );
+			 if ( k != 0. )
+				 for ( unsigned int it=0; ; it++ )
+				 {
+					 const double residual = unnotched_radius + k * std::pow(unnotched_radius,1.5) - notched_radius;
+					 if ( std::abs(residual) < 1e-14 * radius )
+						 break;
+					 AssertThrow( it < 50, ExcMessage("numEx - NotchedRodManifold<< The inversion of the notching did not converge."));
+					 unnotched_radius -= residual / ( 1. + 1.5 * k * std::sqrt(unnotched_radius) );
+				 }
+
+			Point<dim> chart_point = space_point;
+			if ( on_surface )
+			{
+				chart_point[0] = unnotched_radius;
+				chart_point[1] = std::atan2( space_point[z], space_point[x] );
+				chart_point[2] = space_point[y];
+			}
+			else if ( notched_radius > 0. )
+			{
+				chart_point[x] *= unnotched_radius / notched_radius;
+				chart_point[z] *= unnotched_radius / notched_radius;
+			}
+			return chart_point;
+		}
+
+		virtual Point<dim> push_forward ( const Point<dim> &chart_point ) const override
+		{
+			Point<dim> space_point = chart_point;
+			if ( on_surface )
+			{
+				space_point[x] = chart_point[0] * std::cos(chart_point[1]);
+				space_point[y] = chart_point[2];
+				space_point[z] = chart_point[0] * std::sin(chart_point[1]);
+			}
+
+			// The same shift as in \a notch_body: x and z are scaled by 1 + k*sqrt(r)
+			 const double unnotched_radius = std::sqrt( space_point[x]*space_point[x] + space_point[z]*space_point[z] );
+			 const double scaling = 1. + get_shift_factor( space_point[y] ) * std::sqrt(unnotched_radius);
+			 space_point[x] *= scaling;
+			 space_point[z] *= scaling;
+			return space_point;
+		}
+
+	private:
+		enum enum_coord_directions
+		{
+			x = 0, y = 1, z = 2
+		};
+
+		/**
+		 * The factor k of the notching r -> r + k*r^1.5 at the height \a y_coord, zero outside of the notched area
+		 */
+		double get_shift_factor ( const double y_coord ) const
+		{
+			double distance_y = std::abs( offset - y_coord );
+			if ( distance_y >= half_notch_length )
+				return 0.;
+			const double current_notch_radius = get_current_notch_radius( notch_type, distance_y, half_notch_length, radius, notch_radius, R );
+			return (current_notch_radius - radius) / std::pow(radius,1.5);
+		}
+
+		const double half_notch_length;
+		const double radius;
+		const double notch_radius;
+		const double R;
+		const unsigned int notch_type;
+		const bool on_surface;
+		const double offset;
+	};
+
+
+	/**
+	 * Higher order mapping with precomputed support points (\a MappingQCache) that matches the manifolds attached to the triangulation.
+	 * A plain \a MappingQGeneric queries the manifolds (e.g. the projection onto a cylinder) for the support points of a cell every time
+	 * FEValues is reinitialised on it. Here, the support points of all cells are computed once and reused in the assembly and
+	 * the post-processing.
+	 * Each cache belongs to one triangulation. After the triangulation changed (refinement, coarsening, clear) or signalled a mesh movement,
+	 * the next call of \a get recomputes the support points in place, so the mapping returned earlier (e.g. held by FEValues or DataOut)
+	 * stays valid.
+	 * @note Vertices that are moved by hand (e.g. \a shift_vertex_layer, \a notch_body) do not trigger a signal, so call \a clear()
+	 * or trigger \a triangulation.signals.mesh_movement() in case the mesh is moved after the first call of \a get.
+	 * @note Use \a get_manifold_mapping to get the cache of a triangulation.
+	 */
+	template<int dim>
+	class ManifoldMappingCache
+	{
+	public:
+		ManifoldMappingCache ( const Triangulation<dim> &triangulation, const unsigned int mapping_degree=2 )
+		:
+		tria(&triangulation),
+		degree(mapping_degree),
+		mapping_cache(mapping_degree)
+		{
+			AssertThrow( mapping_degree>=1, ExcMessage("ManifoldMappingCache<< The mapping needs at least a degree of one."));
+
+			tria_listener = triangulation.signals.any_change.connect( [this] () { outdated = true; } );
+			movement_listener = triangulation.signals.mesh_movement.connect( [this] () { outdated = true; } );
+		}
+
+		~ManifoldMappingCache ()
+		{
+			tria_listener.disconnect();
+			movement_listener.disconnect();
+		}
+
+		ManifoldMappingCache ( const ManifoldMappingCache<dim> & ) = delete;
+		ManifoldMappingCache<dim> &operator= ( const ManifoldMappingCache<dim> & ) = delete;
+
+		/**
+		 * @return The mapping for the current state of the triangulation
+		 */
+		const Mapping<dim> &get ()
+		{
+			AssertThrow( triangulation_exists(), ExcMessage("ManifoldMappingCache<< The triangulation of this cache does no longer exist."));
+
+			// The support points are placed by the manifolds of the triangulation (evaluated in parallel over the cells)
+			 if ( outdated )
+			 {
+				 mapping_cache.initialize( MappingQGeneric<dim>( degree ), *tria );
+				 outdated = false;
+			 }
+
+			return mapping_cache;
+		}
+
+		/**
+		 * Recompute the support points with the next call of \a get, e.g. after moving vertices by hand
+		 */
+		void clear ()
+		{
+			outdated = true;
+		}
+
+		/**
+		 * @return Whether the triangulation still exists. A disconnected listener means that the triangulation we listened to
+		 * was destroyed, even though a new one might now be located at the same address.
+		 */
+		bool triangulation_exists () const
+		{
+			return tria_listener.connected();
+		}
+
+	private:
+		bool outdated = true;
+		const Triangulation<dim> *tria;
+		const unsigned int degree;
+		MappingQCache<dim> mapping_cache;
+		boost::signals2::connection tria_listener;
+		boost::signals2::connection movement_listener;
+	};
+
+
+	/**
+	 * @return The cached higher order mapping (see \a ManifoldMappingCache) of degree \a mapping_degree for the \a triangulation.
+	 * There is one cache per triangulation and degree, so several meshes (e.g. of different example instances) keep their own mapping,
+	 * and the returned reference stays valid as long as the triangulation exists (also across refinements).
+	 * The caches of destroyed triangulations are removed with the next call.
+	 */
+	template<int dim>
+	const Mapping<dim> &get_manifold_mapping ( const Triangulation<dim> &triangulation, const unsigned int mapping_degree=2 )
+	{
+		static std::mutex mutex;
+		static std::map< std::pair<const Triangulation<dim>*,unsigned int>, std::unique_ptr<ManifoldMappingCache<dim>> > caches;
+
+		std::lock_guard<std::mutex> lock ( mutex );
+		for ( auto it=caches.begin(); it!=caches.end(); )
+		{
+			if ( it->second->triangulation_exists() )
+				++it;
+			else
+				it = caches.erase(it);
+		}
+
+		std::unique_ptr<ManifoldMappingCache<dim>> &cache = caches[ std::make_pair( &triangulation, mapping_degree ) ];
+		if ( cache==nullptr )
+			cache.reset( new ManifoldMappingCache<dim>( triangulation, mapping_degree ) );
+		return cache->get();
+	}
+
+
+	template <int dim>
+	class EvalPointClass
+	{
+	public:
+		EvalPointClass() = default;
+
+		// Evaluation point and coordinate direction (x,y,z)
+		 EvalPointClass ( Point<3> eval_point , unsigned int direction )
+		 :
+		 eval_point(eval_point),
+		 direction(direction)
+		 {
+		 }
+		// @todo-extent If needed we can also add a Point together with a direction vector for evaluation.
+		// This flexibility is actually the reason this class was created and not replaced by a std::pair or similar.
+
+		 Point<3> eval_point;
+		 unsigned int direction = 99;
+
+		 double extract_disp_component ( const Vector<double> &pt_solution )
+		 {
+			 if ( direction == 99 )
+				 AssertThrow( false, ExcMessage("EvalPointClass<< You have not declared the evaluation point properly. "
+						 	 	 	 	 	    "We require a direction (x,y,z) or a direction vector "
+						 	 	 	 	 	    "(the latter is not yet implemented)."));
+			 return pt_solution[direction];
+		 }
+
+		// Write and read the evaluation point with boost serialization (e.g. for the \a MeshCache)
+		 template <class Archive>
+		 void serialize ( Archive &ar, const unsigned int /*version*/ )
+		 {
+			 ar & eval_point & direction;
+		 }
+	};
+
+	/**
+	 * Evaluate the displacement components requested by a list of \a EvalPointClass (e.g. \a eval_points_list) in every load step
+	 * without searching the mesh again.
+	 * The owning cells and the reference coordinates of all points are found only once after \a make_grid and every refinement.
+	 * We then store the DoF indices of each owning cell together with the values of the shape functions of the requested
+	 * displacement component at the reference point. Each evaluation thereby reduces to a short dot product with the solution vector.
+	 * The evaluator is reset when the DoFHandler, its triangulation or the number of DoFs changed, and on every change of the
+	 * triangulation (refinement, coarsening, clear), signalled via the triangulation.
+	 * @note On a distributed triangulation, each point is evaluated by the rank(s) owning the cell around it and the values are summed
+	 * over all ranks, so every rank obtains all values. The solution vector needs to contain the DoFs of the locally owned cells.
+	 * @note Renumbering the DoFs does not change the number of DoFs, so call \a clear() after renumbering.
+	 */
+	template<int dim>
+	class EvalPointEvaluator
+	{
+	public:
+		EvalPointEvaluator () = default;
+
+		~EvalPointEvaluator ()
+		{
+			tria_listener.disconnect();
+		}
+
+		EvalPointEvaluator ( const EvalPointEvaluator<dim> & ) = delete;
+		EvalPointEvaluator<dim> &operator= ( const EvalPointEvaluator<dim> & ) = delete;
+
+		/**
+		 * Set the points to be evaluated and the (possibly curved) \a mapping that is used to find them in the mesh.
+		 * The \a mapping must outlive the evaluator.
+		 */
+		void reinit ( const std::vector< EvalPointClass<3> > &eval_points_list, const Mapping<dim> &mapping=StaticMappingQ1<dim>::mapping )
+		{
+			eval_points = eval_points_list;
+			cached_mapping = &mapping;
+			outdated = true;
+		}
+
+		/**
+		 * Evaluate the displacement component of each evaluation point for the \a solution on the \a dof_handler
+		 * @return The values in the order of the \a eval_points_list given to \a reinit
+		 */
+		template<typename VectorType>
+		std::vector<double> evaluate ( const DoFHandler<dim> &dof_handler, const VectorType &solution )
+		{
+			if ( outdated || &dof_handler != cached_dof_handler
+				 || &dof_handler.get_triangulation() != cached_tria || dof_handler.n_dofs() != cached_n_dofs )
+				locate_points( dof_handler );
+
+			std::vector<double> values ( eval_points.size(), 0. );
+			for ( unsigned int p=0; p<eval_points.size(); p++ )
+				for ( unsigned int i=0; i<dof_indices[p].size(); i++ )
+					values[p] += shape_values[p][i] * solution( dof_indices[p][i] );
+
+			// Each point is owned by at least one rank, a point on the interface between cells might be owned by several ranks
+			 if ( is_distributed(*cached_tria) )
+			 {
+				 Utilities::MPI::sum( values, cached_tria->get_communicator(), values );
+				 for ( unsigned int p=0; p<eval_points.size(); p++ )
+					 values[p] /= n_owners[p];
+			 }
+
+			return values;
+		}
+
+		/**
+		 * Search the points again with the next call of \a evaluate, e.g. after renumbering the DoFs
+		 */
+		void clear ()
+		{
+			outdated = true;
+		}
+
+	private:
+		void locate_points ( const DoFHandler<dim> &dof_handler )
+		{
+			AssertThrow( cached_mapping != nullptr, ExcMessage("EvalPointEvaluator<< Set the evaluation points via reinit(*) before the first evaluation."));
+
+			cached_dof_handler = &dof_handler;
+			cached_tria = &dof_handler.get_triangulation();
+			cached_n_dofs = dof_handler.n_dofs();
+
+			tria_listener.disconnect();
+			tria_listener = dof_handler.get_triangulation().signals.any_change.connect( [this] () { outdated = true; } );
+
+			const FiniteElement<dim> &fe = dof_handler.get_fe();
+			dof_indices.assign( eval_points.size(), std::vector<types::global_dof_index>() );
+			shape_values.assign( eval_points.size(), std::vector<double>() );
+			n_owners.assign( eval_points.size(), 0. );
+
+			for ( unsigned int p=0; p<eval_points.size(); p++ )
+			{
+				const unsigned int component = eval_points[p].direction;
+				AssertThrow( component < fe.n_components(),
+							 ExcMessage("EvalPointEvaluator<< You have not declared the evaluation point properly. "
+										"We require a direction (x,y,z) or a direction vector (the latter is not yet implemented)."));
+
+				// This is the only global search for this point until the mesh or the DoFs change
+				 std::pair< typename DoFHandler<dim>::active_cell_iterator, Point<dim> > cell_and_ref_point;
+				 try
+				 {
+					cell_and_ref_point = GridTools::find_active_cell_around_point( *cached_mapping, dof_handler, extract_dim<dim>(eval_points[p].eval_point) );
+				 }
+				 catch ( ... )
+				 {
+					// On a distributed triangulation, the point might lie in a part of the mesh that is not stored on this rank
+					 AssertThrow( is_distributed(*cached_tria), ExcMessage("EvalPointEvaluator<< The evaluation point does not lie inside the mesh."));
+					 continue;
+				 }
+				 if ( !cell_and_ref_point.first->is_locally_owned() )
+					 continue;
+
+				n_owners[p] = 1.;
+
+				// Only keep the shape functions of the requested component
+				 std::vector<types::global_dof_index> local_dof_indices ( fe.dofs_per_cell );
+				 cell_and_ref_point.first->get_dof_indices( local_dof_indices );
+				 for ( unsigned int i=0; i<fe.dofs_per_cell; i++ )
+				 {
+					 const double shape_value = fe.is_primitive(i)
+												? ( ( fe.system_to_component_index(i).first == component ) ? fe.shape_value( i, cell_and_ref_point.second ) : 0. )
+												: fe.shape_value_component( i, cell_and_ref_point.second, component );
+					 if ( shape_value != 0. )
+					 {
+						 dof_indices[p].push_back( local_dof_indices[i] );
+						 shape_values[p].push_back( shape_value );
+					 }
+				 }
+			}
+
+			if ( is_distributed(*cached_tria) )
+			{
+				Utilities::MPI::sum( n_owners, cached_tria->get_communicator(), n_owners );
+				for ( unsigned int p=0; p<eval_points.size(); p++ )
+					AssertThrow( n_owners[p] > 0., ExcMessage("EvalPointEvaluator<< The evaluation point does not lie inside the mesh."));
+			}
+
+			outdated = false;
+		}
+
+		bool outdated = true;
+		std::vector< EvalPointClass<3> > eval_points;
+		const Mapping<dim> *cached_mapping = nullptr;
+		const DoFHandler<dim> *cached_dof_handler = nullptr;
+		const Triangulation<dim> *cached_tria = nullptr;
+		types::global_dof_index cached_n_dofs = 0;
+		boost::signals2::connection tria_listener;
+		// For each point: the DoFs of the owning cell with a non-zero shape function in the requested component and these shape values
+		 std::vector< std::vector<types::global_dof_index> > dof_indices;
+		 std::vector< std::vector<double> > shape_values;
+		// Number of ranks that own the cell around the point (always 1 on a serial triangulation)
+		 std::vector<double> n_owners;
+	};
+
+	/**
+	 * Persistent on-disk cache for the result of a \a make_grid function.
+	 * The key of the cache is a hash of the name of the numerical example and all the values added via \a add_to_key
+	 * (e.g. the relevant fields of the GeneralParameters). On a cache miss we run \a make_grid and store the final triangulation
+	 * (incl. the boundary, manifold and material ids) and all the variables registered via \a store (e.g. \a body_dimensions,
+	 * \a eval_points_list) in a binary archive. On a hit we load all this and skip the mesh generation entirely.
+	 * @note The manifold objects cannot be serialised, hence the \a attach_manifolds function has to attach them again.
+	 * @note Everything that \a make_grid sets and that is not registered via \a store is missing on a warm start.
+	 * @todo Only implemented for serial triangulations, for a distributed triangulation \a make_grid is always run without the cache
+	 */
+	template<int dim>
+	class MeshCache
+	{
+	public:
+		MeshCache ( const std::string &numEx_name, const std::string &cache_prefix="mesh_cache-" )
+		:
+		name(numEx_name),
+		prefix(cache_prefix)
+		{
+			hash_bytes( name.data(), name.size() );
+			add_to_key( dim );
+			add_to_key( cache_version );
+		}
+
+		/**
+		 * Add a value (e.g. a parameter) that influences the mesh to the key of the cache
+		 */
+		template<typename Number>
+		MeshCache<dim> &add_to_key ( const Number value )
+		{
+			const double value_double = value; // one type for all arithmetic values, so e.g. 1 and 1.0 give the same key
+			hash_bytes( &value_double, sizeof(double) );
+			return *this;
+		}
+
+		/**
+		 * Register a variable that is set by \a make_grid, so it is stored in and restored from the cache
+		 */
+		template<typename DataType>
+		MeshCache<dim> &store ( DataType &data )
+		{
+			savers.push_back( [&data] ( boost::archive::binary_oarchive &archive ) { archive << data; } );
+			loaders.push_back( [&data] ( boost::archive::binary_iarchive &archive ) { archive >> data; } );
+			return *this;
+		}
+
+		std::string get_filename () const
+		{
+			std::ostringstream filename;
+			filename << prefix << name << "-" << std::hex << hash << ".bin";
+			return filename.str();
+		}
+
+		/**
+		 * Load the triangulation and the stored variables from the cache or run \a make_grid and fill the cache
+		 * @return True if the mesh was loaded from the cache
+		 */
+		template<typename MakeGridType, typename AttachManifoldsType>
+		bool make_grid ( Triangulation<dim> &triangulation, const MakeGridType &make_grid, const AttachManifoldsType &attach_manifolds )
+		{
+			// The archive only contains a serial triangulation
+			 if ( is_distributed(triangulation) )
+			 {
+				make_grid();
+				return false;
+			 }
+
+			const std::string filename = get_filename();
+
+			// Warm start
+			 std::ifstream in ( filename.c_str(), std::ios::binary );
+			 if ( in )
+			 {
+				try
+				{
+					triangulation.clear();
+					boost::archive::binary_iarchive archive ( in );
+					archive >> triangulation;
+					for ( unsigned int i=0; i<loaders.size(); i++ )
+						loaders[i]( archive );
+					attach_manifolds();
+					std::cout << "numEx<< Loaded the mesh of " << name << " from the cache " << filename << std::endl;
+					return true;
+				}
+				catch ( const std::exception &exc )
+				{
+					// A corrupt or outdated cache file is simply regenerated
+					 std::cout << "numEx<< Could not read the mesh cache " << filename << " (" << exc.what() << "), generating the mesh ..." << std::endl;
+					 triangulation.clear();
+				}
+			 }
+			 in.close();
+
+			// Cold start: generate the mesh and store it
+			// We write to a temporary file first, so concurrent runs never read a partially written cache.
+			// The name of the temporary file is unique for each process and thread, so concurrent runs do not write to the same file.
+			 make_grid();
+
+			 std::ostringstream filename_tmp_stream;
+			 filename_tmp_stream << filename << "." << ::getpid() << "-" << std::hash<std::thread::id>()( std::this_thread::get_id() ) << ".tmp";
+			 const std::string filename_tmp = filename_tmp_stream.str();
+			 {
+				std::ofstream out ( filename_tmp.c_str(), std::ios::binary );
+				AssertThrow( out, ExcMessage("numEx - MeshCache<< Could not open the file "+filename_tmp));
+				boost::archive::binary_oarchive archive ( out );
+				archive << triangulation;
+				for ( unsigned int i=0; i<savers.size(); i++ )
+					savers[i]( archive );
+			 }
+			 std::rename( filename_tmp.c_str(), filename.c_str() );
+
+			return false;
+		}
+
+	private:
+		// FNV-1a, which (in contrast to std::hash) gives the same key in every run
+		void hash_bytes ( const void *data, const std::size_t n_bytes )
+		{
+			const unsigned char *bytes = static_cast<const unsigned char*>(data);
+			for ( std::size_t i=0; i<n_bytes; i++ )
+			{
+				hash ^= bytes[i];
+				hash *= 1099511628211ull;
+			}
+		}
+
+		// Increase the version to invalidate all existing cache files (e.g. if the content of the archive changed)
+		 const unsigned int cache_version = 1;
+
+		const std::string name;
+		const std::string prefix;
+		std::uint64_t hash = 14695981039346656037ull;
+		std::vector< std::function<void(boost::archive::binary_oarchive&)> > savers;
+		std::vector< std::function<void(boost::archive::binary_iarchive&)> > loaders;
+	};
+
+
+	/**
+	 * Broad phase of the contact search between the boundary faces of the body and rigid bodies (e.g. punch, die, walls):
+	 * Instead of evaluating the gap of every boundary quadrature point with respect to every rigid body,
+	 * the contact assembly only considers the candidate (face, body) pairs whose bounding boxes intersect.
+	 * - Each rigid body is given by the boundary ID of the faces it can touch (constructor) and its bounding box at the current
+	 *   position, which is set after each move of the body (\a set_body_box).
+	 * - The bounding boxes of the boundary faces are stored in an R-tree, which is built in the reference configuration
+	 *   or in the current configuration from the displacements at the vertices (\a update_faces).
+	 * - The candidates of each body are kept between the load steps (Verlet list): We query the R-tree with the body box
+	 *   enlarged by the \a skin and only query again, when the body box or a vertex moved by more than half the skin since then.
+	 * Any change of the triangulation (e.g. refinement) invalidates the faces, so call \a update_faces again afterwards.
+	 * @note The body box has to contain the entire region in which the body detects contact (including the contact tolerance).
+	 * @note The face boxes span the vertices of the face, so for curved faces (higher order mappings) the \a skin also has to cover the curvature.
+	 */
+	template<int dim>
+	class ContactBroadPhase
+	{
+	public:
+		typedef std::pair< typename Triangulation<dim>::active_cell_iterator, unsigned int > FaceCandidate;
+
+		/**
+		 * @param boundary_ids_of_bodies For each rigid body the boundary ID of the faces that can come into contact with it
+		 */
+		ContactBroadPhase ( const double skin_distance, const std::vector<types::boundary_id> &boundary_ids_of_bodies )
+		:
+		skin(skin_distance),
+		body_boundary_ids(boundary_ids_of_bodies),
+		body_boxes(boundary_ids_of_bodies.size()),
+		queried_boxes(boundary_ids_of_bodies.size()),
+		body_queried(boundary_ids_of_bodies.size(),false),
+		candidates(boundary_ids_of_bodies.size()),
+		candidate_masks(boundary_ids_of_bodies.size()),
+		faces_outdated(std::make_shared<bool>(true))
+		{
+		}
+
+		unsigned int n_bodies () const
+		{
+			return body_boundary_ids.size();
+		}
+
+		/**
+		 * @return Whether the faces are set for the current triangulation, so the candidates can be used
+		 */
+		bool faces_up_to_date () const
+		{
+			return !(*faces_outdated);
+		}
+
+		/**
+		 * Set the faces in the reference configuration of the \a triangulation
+		 */
+		void update_faces ( const Triangulation<dim> &triangulation )
+		{
+			update_face_tree( triangulation, triangulation.get_vertices() );
+		}
+
+		/**
+		 * Set the faces in the current configuration, i.e. the vertices of the triangulation moved by the \a displacement
+		 * (components 0 to dim-1 of the finite element, which needs DoFs on the vertices, e.g. FE_Q)
+		 * @note On a distributed triangulation the \a displacement has to contain the ghost entries of the locally owned cells.
+		 */
+		template<typename VectorType>
+		void update_faces ( const DoFHandler<dim> &dof_handler, const VectorType &displacement )
+		{
+			const FiniteElement<dim> &fe = dof_handler.get_fe();
+			AssertThrow( fe.dofs_per_vertex > 0, ExcMessage("ContactBroadPhase<< The finite element needs DoFs on the vertices to move the faces."));
+
+			std::vector< Point<dim> > positions = dof_handler.get_triangulation().get_vertices();
+			std::vector<bool> vertex_moved ( positions.size(), false );
+			for ( typename DoFHandler<dim>::active_cell_iterator
+				  cell = dof_handler.begin_active();
+				  cell != dof_handler.end(); ++cell )
+			{
+				if ( !cell->is_locally_owned() || !cell->at_boundary() )
+					continue;
+
+				for ( unsigned int v=0; v<GeometryInfo<dim>::vertices_per_cell; v++ )
+					if ( !vertex_moved[cell->vertex_index(v)] )
+					{
+						for ( unsigned int i=0; i<fe.dofs_per_vertex; i++ )
+						{
+							const unsigned int component = fe.system_to_component_index( v*fe.dofs_per_vertex + i ).first;
+							if ( component < dim )
+								positions[cell->vertex_index(v)][component] += displacement( cell->vertex_dof_index(v,i) );
+						}
+						vertex_moved[cell->vertex_index(v)] = true;
+					}
+			}
+
+			update_face_tree( dof_handler.get_triangulation(), positions );
+		}
+
+		/**
+		 * Set the bounding box of the \a body at its current position and update its candidates if necessary
+		 */
+		void set_body_box ( const unsigned int body, const BoundingBox<dim> &box )
+		{
+			AssertIndexRange( body, n_bodies() );
+			AssertThrow( !(*faces_outdated), ExcMessage("ContactBroadPhase<< The faces are outdated, call update_faces first."));
+
+			body_boxes[body] = box;
+			if ( !body_queried[body] || get_movement(queried_boxes[body],box) > skin/2. )
+				query( body );
+		}
+
+		/**
+		 * @return The candidate faces (cell, face number) of the \a body
+		 */
+		const std::vector<FaceCandidate> &get_candidates ( const unsigned int body ) const
+		{
+			AssertIndexRange( body, n_bodies() );
+			return candidates[body];
+		}
+
+		/**
+		 * @return Whether the face \a face of the \a cell (of the triangulation or a DoFHandler on it) is a candidate for the \a body
+		 */
+		template<typename CellIteratorType>
+		bool is_candidate ( const CellIteratorType &cell, const unsigned int face, const unsigned int body ) const
+		{
+			AssertIndexRange( body, n_bodies() );
+			AssertThrow( !(*faces_outdated), ExcMessage("ContactBroadPhase<< The faces are outdated, call update_faces first."));
+			return ( body_queried[body] && candidate_masks[body][ cell->active_cell_index()*GeometryInfo<dim>::faces_per_cell + face ] );
+		}
+
+		/**
+		 * @return Whether any face of the \a cell is a candidate for any body, so cells without candidates can skip the contact assembly
+		 */
+		template<typename CellIteratorType>
+		bool has_candidates ( const CellIteratorType &cell ) const
+		{
+			AssertThrow( !(*faces_outdated), ExcMessage("ContactBroadPhase<< The faces are outdated, call update_faces first."));
+			return ( n_candidates_of_cell[ cell->active_cell_index() ] > 0 );
+		}
+
+	private:
+		void update_face_tree ( const Triangulation<dim> &triangulation, const std::vector< Point<dim> > &positions )
+		{
+			if ( *faces_outdated || &triangulation != tria || positions.size() != packed_positions.size() )
+				collect_faces( triangulation );
+			else
+			{
+				// Keep the R-tree and the candidates as long as no vertex of a boundary face moved by more than half the skin
+				 double max_movement = 0.;
+				 for ( unsigned int i=0; i<face_vertices.size(); i++ )
+					 for ( unsigned int d=0; d<dim; d++ )
+						 max_movement = std::max( max_movement, std::abs( positions[face_vertices[i]][d] - packed_positions[face_vertices[i]][d] ) );
+				 if ( max_movement <= skin/2. )
+					 return;
+			}
+
+			// Pack the R-tree of the face boxes at the current positions of the vertices
+			 std::vector< std::pair< BoundingBox<dim>, unsigned int > > face_boxes ( faces.size() );
+			 for ( unsigned int f=0; f<faces.size(); f++ )
+			 {
+				 const typename Triangulation<dim>::face_iterator face = faces[f].first->face( faces[f].second );
+				 Point<dim> lower = positions[face->vertex_index(0)];
+				 Point<dim> upper = lower;
+				 for ( unsigned int v=1; v<GeometryInfo<dim>::vertices_per_face; v++ )
+					 for ( unsigned int d=0; d<dim; d++ )
+					 {
+						 lower[d] = std::min( lower[d], positions[face->vertex_index(v)][d] );
+						 upper[d] = std::max( upper[d], positions[face->vertex_index(v)][d] );
+					 }
+				 face_boxes[f] = std::make_pair( BoundingBox<dim>( std::make_pair(lower,upper) ), f );
+			 }
+			 face_tree = pack_rtree( face_boxes );
+			 packed_positions = positions;
+
+			// Update the candidates of all bodies with known position
+			 for ( unsigned int body=0; body<n_bodies(); body++ )
+				 if ( body_queried[body] )
+					 query( body );
+		}
+
+		/**
+		 * Collect the locally owned boundary faces with the boundary IDs of the bodies
+		 */
+		void collect_faces ( const Triangulation<dim> &triangulation )
+		{
+			faces.clear();
+			face_boundary_ids.clear();
+			face_vertices.clear();
+			std::vector<bool> vertex_collected ( triangulation.n_vertices(), false );
+			for ( typename Triangulation<dim>::active_cell_iterator
+				  cell = triangulation.begin_active();
+				  cell != triangulation.end(); ++cell )
+			{
+				if ( !cell->is_locally_owned() || !cell->at_boundary() )
+					continue;
+
+				for ( unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; face++ )
+					if ( cell->face(face)->at_boundary()
+						 && std::find( body_boundary_ids.begin(), body_boundary_ids.end(), cell->face(face)->boundary_id() ) != body_boundary_ids.end() )
+					{
+						faces.push_back( FaceCandidate(cell,face) );
+						face_boundary_ids.push_back( cell->face(face)->boundary_id() );
+						for ( unsigned int v=0; v<GeometryInfo<dim>::vertices_per_face; v++ )
+							if ( !vertex_collected[cell->face(face)->vertex_index(v)] )
+							{
+								face_vertices.push_back( cell->face(face)->vertex_index(v) );
+								vertex_collected[cell->face(face)->vertex_index(v)] = true;
+							}
+					}
+			}
+
+			n_candidates_of_cell.assign( triangulation.n_active_cells(), 0 );
+			for ( unsigned int body=0; body<n_bodies(); body++ )
+			{
+				candidates[body].clear();
+				candidate_masks[body].assign( triangulation.n_active_cells()*GeometryInfo<dim>::faces_per_cell, 0 );
+			}
+
+			// The active cell indices are only valid until the triangulation changes. We share the flag with the listener,
+			// so the object stays movable.
+			 tria = &triangulation;
+			 faces_outdated = std::make_shared<bool>(false);
+			 const std::shared_ptr<bool> outdated = faces_outdated;
+			 tria_listener = std::make_shared<boost::signals2::scoped_connection>(
+								triangulation.signals.any_change.connect( [outdated] () { *outdated = true; } ) );
+		}
+
+		void query ( const unsigned int body )
+		{
+			// Remove the previous candidates of the body
+			 for ( unsigned int i=0; i<candidates[body].size(); i++ )
+			 {
+				 const unsigned int cell_index = candidates[body][i].first->active_cell_index();
+				 candidate_masks[body][ cell_index*GeometryInfo<dim>::faces_per_cell + candidates[body][i].second ] = 0;
+				 n_candidates_of_cell[cell_index] -= 1;
+			 }
+			 candidates[body].clear();
+
+			BoundingBox<dim> search_box = body_boxes[body];
+			search_box.extend( skin );
+			std::vector< std::pair< BoundingBox<dim>, unsigned int > > hits;
+			face_tree.query( boost::geometry::index::intersects(search_box), std::back_inserter(hits) );
+
+			for ( unsigned int i=0; i<hits.size(); i++ )
+			{
+				const unsigned int f = hits[i].second;
+				if ( face_boundary_ids[f] != body_boundary_ids[body] )
+					continue;
+
+				candidates[body].push_back( faces[f] );
+				const unsigned int cell_index = faces[f].first->active_cell_index();
+				candidate_masks[body][ cell_index*GeometryInfo<dim>::faces_per_cell + faces[f].second ] = 1;
+				n_candidates_of_cell[cell_index] += 1;
+			}
+
+			queried_boxes[body] = body_boxes[body];
+			body_queried[body] = true;
+		}
+
+		/**
+		 * The largest displacement of a corner between the two boxes
+		 */
+		static double get_movement ( const BoundingBox<dim> &box_old, const BoundingBox<dim> &box_new )
+		{
+			double movement = 0.;
+			for ( unsigned int d=0; d<dim; d++ )
+			{
+				movement = std::max( movement, std::abs( box_new.get_boundary_points().first[d] - box_old.get_boundary_points().first[d] ) );
+				movement = std::max( movement, std::abs( box_new.get_boundary_points().second[d] - box_old.get_boundary_points().second[d] ) );
+			}
+			return movement;
+		}
+
+		double skin;
+		std::vector<types::boundary_id> body_boundary_ids;
+		std::vector< BoundingBox<dim> > body_boxes;
+		std::vector< BoundingBox<dim> > queried_boxes;
+		std::vector<bool> body_queried;
+		std::vector< std::vector<FaceCandidate> > candidates;
+		// @note We use unsigned char instead of bool for the fast access in the assembly
+		 std::vector< std::vector<unsigned char> > candidate_masks;
+		std::vector<unsigned int> n_candidates_of_cell;
+
+		const Triangulation<dim> *tria = nullptr;
+		std::vector<FaceCandidate> faces;
+		std::vector<types::boundary_id> face_boundary_ids;
+		std::vector<unsigned int> face_vertices;
+		std::vector< Point<dim> > packed_positions;
+		RTree< std::pair< BoundingBox<dim>, unsigned int > > face_tree;
+
+		std::shared_ptr<bool> faces_outdated;
+		std::shared_ptr<boost::signals2::scoped_connection> tria_listener;
+	};
+
+	/**
+	 * Boundary quadrature points in structure-of-arrays layout (one array per coordinate) for the batched gap evaluation of
+	 * the rigid bodies (\a RigidSphere, \a RigidHalfWall). The arrays are padded to a multiple of the SIMD width by repeating the
+	 * last point, so the evaluation can always load full VectorizedArray<double>.
+	 */
+	template<int dim>
+	struct ContactPointBatch
+	{
+		void resize ( const unsigned int n_points )
+		{
+			n = n_points;
+			const unsigned int width = VectorizedArray<double>::size();
+			for ( unsigned int d=0; d<dim; d++ )
+				coordinates[d].resize( ( (n_points+width-1)/width ) * width );
+		}
+
+		/**
+		 * Set the (current) position of the point \a i
+		 */
+		void set_point ( const unsigned int i, const Point<dim> &point )
+		{
+			for ( unsigned int d=0; d<dim; d++ )
+				coordinates[d][i] = point[d];
+		}
+
+		/**
+		 * Fill the padding after the last point, call this after all points were set
+		 */
+		void finalize ()
+		{
+			for ( unsigned int d=0; d<dim; d++ )
+				for ( unsigned int i=n; i<coordinates[d].size(); i++ )
+					coordinates[d][i] = ( n>0 ? coordinates[d][n-1] : 0. );
+		}
+
+		unsigned int size () const
+		{
+			return n;
+		}
+
+		unsigned int n_padded () const
+		{
+			return coordinates[0].size();
+		}
+
+		unsigned int n = 0;
+		std::vector<double> coordinates[dim];
+	};
+
+	/**
+	 * Results of the batched gap evaluation, in the same layout as the \a ContactPointBatch:
+	 * The gap (negative for penetration), the unit normal of the rigid body (pointing towards the deformable body) and
+	 * the active flag (1 for active points, 0 else). The flags are stored as double, so the assembly can simply multiply
+	 * the penalty terms with them.
+	 */
+	template<int dim>
+	struct ContactGapBatch
+	{
+		void resize ( const ContactPointBatch<dim> &points )
+		{
+			gap.resize( points.n_padded() );
+			active.resize( points.n_padded() );
+			for ( unsigned int d=0; d<dim; d++ )
+				normal[d].resize( points.n_padded() );
+		}
+
+		std::vector<double> gap;
+		std::vector<double> normal[dim];
+		std::vector<double> active;
+	};
+
+	/**
+	 * Region around an axis, in which a rigid body detects contact: rho_min <= distance from the axis <= rho_max.
+	 * For the axisymmetric tools (punch, die, blank holder) this gives the same geometry in 2D (with the axis in the symmetry plane x=0)
+	 * and in 3D (e.g. for the quarter model with the symmetry planes x=0 and z=0).
+	 * By default (zero \a axis), the region is not limited.
+	 */
+	template<int dim>
+	struct RadialRange
+	{
+		bool is_limited () const
+		{
+			return ( axis.norm_square() > 0 );
+		}
+
+		/**
+		 * Set the values of the points \a positions outside of the range to zero
+		 */
+		VectorizedArray<double> apply ( const VectorizedArray<double> (&positions)[dim], const VectorizedArray<double> &values ) const
+		{
+			const VectorizedArray<double> zero = make_vectorized_array( 0. );
+			VectorizedArray<double> distance_squared = zero;
+			VectorizedArray<double> distance_along_axis = zero;
+			for ( unsigned int d=0; d<dim; d++ )
+			{
+				const VectorizedArray<double> relative_position = positions[d] - axis_point[d];
+				distance_squared += relative_position * relative_position;
+				distance_along_axis += relative_position * axis[d];
+			}
+			const VectorizedArray<double> rho_squared = distance_squared - distance_along_axis * distance_along_axis;
+
+			VectorizedArray<double> result = compare_and_apply_mask<SIMDComparison::greater_than_or_equal>( rho_squared, make_vectorized_array(rho_min*rho_min), values, zero );
+			return compare_and_apply_mask<SIMDComparison::less_than_or_equal>( rho_squared, make_vectorized_array(rho_max*rho_max), result, zero );
+		}
+
+		/**
+		 * Limit the bounding box \a box to the range (only the outer radius matters)
+		 */
+		void limit_box ( std::pair< Point<dim>, Point<dim> > &box ) const
+		{
+			if ( !is_limited() || rho_max == std::numeric_limits<double>::infinity() )
+				return;
+			for ( unsigned int d=0; d<dim; d++ )
+			{
+				const double extent = rho_max * std::sqrt( std::max( 0., 1. - axis[d]*axis[d] ) );
+				if ( extent > 0 )
+				{
+					box.first[d] = std::max( box.first[d], axis_point[d] - extent );
+					box.second[d] = std::min( box.second[d], axis_point[d] + extent );
+				}
+			}
+		}
+
+		Point<dim> axis_point;
+		Tensor<1,dim> axis;
+		double rho_min = 0.;
+		double rho_max = std::numeric_limits<double>::infinity();
+	};
+
+	/**
+	 * Rigid sphere (circle in 2D), e.g. a punch, with the deformable body outside of the sphere.
+	 * The geometry has to be set up by the example from the same parameters as the rigid body of the contact library (including its motion),
+	 * because these classes do not expose their geometry.
+	 */
+	template<int dim>
+	struct RigidSphere
+	{
+		/**
+		 * Evaluate the gap, normal and active flag of all the \a points.
+		 * Points with a gap below the \a gap_tolerance are active.
+		 */
+		void evaluate_gaps ( const ContactPointBatch<dim> &points, ContactGapBatch<dim> &results, const double gap_tolerance=0. ) const
+		{
+			results.resize( points );
+
+			const VectorizedArray<double> zero = make_vectorized_array( 0. );
+			const VectorizedArray<double> one = make_vectorized_array( 1. );
+			const VectorizedArray<double> tolerance = make_vectorized_array( gap_tolerance );
+			// Avoids the division by zero for a point exactly in the center
+			 const VectorizedArray<double> min_distance = make_vectorized_array( 1e-300 );
+
+			for ( unsigned int i=0; i<points.n_padded(); i+=VectorizedArray<double>::size() )
+			{
+				VectorizedArray<double> distance_vector[dim];
+				VectorizedArray<double> distance_squared = zero;
+				for ( unsigned int d=0; d<dim; d++ )
+				{
+					distance_vector[d].load( &points.coordinates[d][i] );
+					distance_vector[d] = distance_vector[d] - center[d];
+					distance_squared += distance_vector[d] * distance_vector[d];
+				}
+				const VectorizedArray<double> distance = std::max( std::sqrt(distance_squared), min_distance );
+
+				const VectorizedArray<double> gap = distance - radius;
+				gap.store( &results.gap[i] );
+				for ( unsigned int d=0; d<dim; d++ )
+					( distance_vector[d] / distance ).store( &results.normal[d][i] );
+
+				compare_and_apply_mask<SIMDComparison::less_than>( gap, tolerance, one, zero ).store( &results.active[i] );
+			}
+		}
+
+		/**
+		 * @return The bounding box of the sphere, e.g. for the \a ContactBroadPhase
+		 */
+		BoundingBox<dim> get_bounding_box () const
+		{
+			std::pair< Point<dim>, Point<dim> > box ( center, center );
+			for ( unsigned int d=0; d<dim; d++ )
+			{
+				box.first[d] -= radius;
+				box.second[d] += radius;
+			}
+			return BoundingBox<dim>( box );
+		}
+
+		Point<dim> center;
+		double radius = 0.;
+	};
+
+	/**
+	 * Rounded edge of a die: a torus around the \a axis through the \a axis_point, with the center line of the tube
+	 * (radius \a major_radius) in the plane through the \a axis_point and the tube radius \a minor_radius.
+	 * The deformable body is outside of the tube. In 2D (axis in the plane) the torus reduces to the two circles of the cross section.
+	 * Use the \a radial_range to limit the contact to a part of the tube, e.g. the inner quarter in between the die opening and the die face.
+	 */
+	template<int dim>
+	struct RigidDieEdge
+	{
+		/**
+		 * Evaluate the gap, normal and active flag of all the \a points.
+		 * Points with a gap below the \a gap_tolerance are active.
+		 */
+		void evaluate_gaps ( const ContactPointBatch<dim> &points, ContactGapBatch<dim> &results, const double gap_tolerance=0. ) const
+		{
+			results.resize( points );
+
+			const VectorizedArray<double> zero = make_vectorized_array( 0. );
+			const VectorizedArray<double> one = make_vectorized_array( 1. );
+			const VectorizedArray<double> tolerance = make_vectorized_array( gap_tolerance );
+			// Avoids the division by zero for a point on the axis or on the center line of the tube
+			 const VectorizedArray<double> min_distance = make_vectorized_array( 1e-300 );
+			const bool limited = radial_range.is_limited();
+
+			for ( unsigned int i=0; i<points.n_padded(); i+=VectorizedArray<double>::size() )
+			{
+				VectorizedArray<double> positions[dim];
+				VectorizedArray<double> relative_position[dim];
+				VectorizedArray<double> distance_along_axis = zero;
+				for ( unsigned int d=0; d<dim; d++ )
+				{
+					positions[d].load( &points.coordinates[d][i] );
+					relative_position[d] = positions[d] - axis_point[d];
+					distance_along_axis += relative_position[d] * axis[d];
+				}
+
+				// The radial part of the relative position points to the closest point on the center line of the tube
+				 VectorizedArray<double> radial_vector[dim];
+				 VectorizedArray<double> rho_squared = zero;
+				 for ( unsigned int d=0; d<dim; d++ )
+				 {
+					 radial_vector[d] = relative_position[d] - distance_along_axis * axis[d];
+					 rho_squared += radial_vector[d] * radial_vector[d];
+				 }
+				 const VectorizedArray<double> scaling = make_vectorized_array( major_radius ) / std::max( std::sqrt(rho_squared), min_distance );
+
+				VectorizedArray<double> distance_vector[dim];
+				VectorizedArray<double> distance_squared = zero;
+				for ( unsigned int d=0; d<dim; d++ )
+				{
+					distance_vector[d] = relative_position[d] - scaling * radial_vector[d];
+					distance_squared += distance_vector[d] * distance_vector[d];
+				}
+				const VectorizedArray<double> distance = std::max( std::sqrt(distance_squared), min_distance );
+
+				const VectorizedArray<double> gap = distance - minor_radius;
+				gap.store( &results.gap[i] );
+				for ( unsigned int d=0; d<dim; d++ )
+					( distance_vector[d] / distance ).store( &results.normal[d][i] );
+
+				VectorizedArray<double> active = compare_and_apply_mask<SIMDComparison::less_than>( gap, tolerance, one, zero );
+				if ( limited )
+					active = radial_range.apply( positions, active );
+				active.store( &results.active[i] );
+			}
+		}
+
+		/**
+		 * @return The bounding box of the torus (limited by the outer radius of the \a radial_range), e.g. for the \a ContactBroadPhase
+		 */
+		BoundingBox<dim> get_bounding_box () const
+		{
+			std::pair< Point<dim>, Point<dim> > box ( axis_point, axis_point );
+			for ( unsigned int d=0; d<dim; d++ )
+			{
+				const double extent = minor_radius + major_radius * std::sqrt( std::max( 0., 1. - axis[d]*axis[d] ) );
+				box.first[d] -= extent;
+				box.second[d] += extent;
+			}
+			radial_range.limit_box( box );
+			return BoundingBox<dim>( box );
+		}
+
+		Point<dim> axis_point;
+		Tensor<1,dim> axis;
+		double major_radius = 0.;
+		double minor_radius = 0.;
+		RadialRange<dim> radial_range;
+	};
+
+	/**
+	 * Rigid wall given by a point on the plane and the unit normal (pointing towards the deformable body).
+	 * For a half wall, the wall only extends from the \a point_on_plane in the \a extension direction (in the plane),
+	 * a zero \a extension gives the infinite wall. Alternatively, the \a radial_range limits the wall to a disc or an annulus
+	 * around an axis (e.g. the bottom of a die or a blank holder in 3D).
+	 */
+	template<int dim>
+	struct RigidHalfWall
+	{
+		/**
+		 * Evaluate the gap, normal and active flag of all the \a points.
+		 * Points with a gap below the \a gap_tolerance are active.
+		 */
+		void evaluate_gaps ( const ContactPointBatch<dim> &points, ContactGapBatch<dim> &results, const double gap_tolerance=0. ) const
+		{
+			results.resize( points );
+
+			const VectorizedArray<double> zero = make_vectorized_array( 0. );
+			const VectorizedArray<double> one = make_vectorized_array( 1. );
+			const VectorizedArray<double> tolerance = make_vectorized_array( gap_tolerance );
+			const bool half_wall = ( extension.norm_square() > 0 );
+			const bool limited = radial_range.is_limited();
+
+			// The normal is constant
+			 for ( unsigned int d=0; d<dim; d++ )
+				 std::fill( results.normal[d].begin(), results.normal[d].end(), normal[d] );
+
+			for ( unsigned int i=0; i<points.n_padded(); i+=VectorizedArray<double>::size() )
+			{
+				VectorizedArray<double> positions[dim];
+				VectorizedArray<double> gap = zero;
+				VectorizedArray<double> position_along_wall = zero;
+				for ( unsigned int d=0; d<dim; d++ )
+				{
+					positions[d].load( &points.coordinates[d][i] );
+					const VectorizedArray<double> relative_position = positions[d] - point_on_plane[d];
+					gap += relative_position * normal[d];
+					position_along_wall += relative_position * extension[d];
+				}
+				gap.store( &results.gap[i] );
+
+				VectorizedArray<double> active = compare_and_apply_mask<SIMDComparison::less_than>( gap, tolerance, one, zero );
+				if ( half_wall )
+					active = compare_and_apply_mask<SIMDComparison::greater_than_or_equal>( position_along_wall, zero, active, zero );
+				if ( limited )
+					active = radial_range.apply( positions, active );
+				active.store( &results.active[i] );
+			}
+		}
+
+		/**
+		 * @return The bounding box of the half space behind the wall, e.g. for the \a ContactBroadPhase.
+		 * Only the coordinate directions of an axis-parallel \a normal and \a extension and the outer radius of the \a radial_range limit the box.
+		 */
+		BoundingBox<dim> get_bounding_box () const
+		{
+			const double far = std::numeric_limits<double>::max() / 4.;
+			std::pair< Point<dim>, Point<dim> > box;
+			for ( unsigned int d=0; d<dim; d++ )
+			{
+				box.first[d] = -far;
+				box.second[d] = far;
+				// The body lies on the side of the normal, so it can only penetrate into the half space behind the wall
+				 if ( std::abs( std::abs(normal[d]) - 1. ) < 1e-12 )
+				 {
+					 if ( normal[d] > 0 )
+						 box.second[d] = point_on_plane[d];
+					 else
+						 box.first[d] = point_on_plane[d];
+				 }
+				if ( std::abs( std::abs(extension[d]) - 1. ) < 1e-12 )
+				{
+					if ( extension[d] > 0 )
+						box.first[d] = std::max( box.first[d], point_on_plane[d] );
+					else
+						box.second[d] = std::min( box.second[d], point_on_plane[d] );
+				}
+			}
+			radial_range.limit_box( box );
+			return BoundingBox<dim>( box );
+		}
+
+		Point<dim> point_on_plane;
+		Tensor<1,dim> normal;
+		Tensor<1,dim> extension;
+		RadialRange<dim> radial_range;
 	};
 }
 
@@ -0,0 +1,248 @@
+#ifndef NUMEX_MATERIAL_POINT
+#define NUMEX_MATERIAL_POINT
+
+// deal.II headers
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/exceptions.h>
+
+// C++ headers
+#include <cmath>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+// Numerical example helper function
+#include "./numEx-helper_fnc.h"
+
+using namespace dealii;
+
+namespace numEx
+{
+	/**
+	 * Driver for a single homogeneous material point, the fast path of the one-element tests
+	 * (HyperCube without refinements, HyperCube_shear, Unconstrained_elastoplastic_test).
+	 * For a homogeneous deformation the finite element solution of these tests is the response of a single material point,
+	 * so instead of setting up DoFHandler, constraints and the linear system in every load step, we directly drive the material
+	 * with the load path from the \a make_material_point_load of the example.
+	 * Per load step, the prescribed components of the displacement gradient are increased by their increments and the free
+	 * components are determined by a Newton iteration, such that the related stress components vanish.
+	 *
+	 * The \a MaterialType has to provide
+	 * - void evaluate ( const Tensor<2,dim> &F, Tensor<2,dim> &P, Tensor<4,dim> &A ):
+	 *   the first Piola-Kirchhoff stress \a P and its derivative A = dP/dF for the deformation gradient \a F,
+	 *   starting from the history of the last accepted load step,
+	 * - void accept (): store the history of the last evaluation as the converged state.
+	 *
+	 * @note Small strain materials can compute the strain from sym(F-I) and return the Cauchy stress and the elasticity tensor.
+	 * The loads of the examples never set both shear components H_ij and H_ji free, so the symmetric stress does not cause
+	 * a singular system.
+	 */
+	template<int dim, typename MaterialType>
+	class MaterialPointDriver
+	{
+	public:
+		MaterialPointDriver ( MaterialType &material_point, const double tolerance=1e-10, const unsigned int max_iterations=25 )
+		:
+		material(material_point),
+		tol(tolerance),
+		max_iter(max_iterations)
+		{
+			reset();
+		}
+
+		/**
+		 * Go back to the undeformed state. The history of the \a material is not touched.
+		 */
+		void reset ()
+		{
+			F = 0;
+			for ( unsigned int i=0; i<dim; i++ )
+				F[i][i] = 1.;
+			P = 0;
+		}
+
+		/**
+		 * Apply the load step \a load and accept the converged state in the \a material
+		 * @return The number of Newton iterations
+		 */
+		unsigned int apply_load_step ( const MaterialPointLoad<dim> &load )
+		{
+			const unsigned int n_iterations = try_load_step( load );
+			AssertThrow( n_iterations != numbers::invalid_unsigned_int,
+						 ExcMessage("MaterialPointDriver<< The stress-free components did not converge within "+std::to_string(max_iter)+" iterations."));
+			return n_iterations;
+		}
+
+		/**
+		 * Apply the load step \a load. If the Newton iteration does not converge or throws, the state of the last load step is restored
+		 * and the \a material is not accepted, so the step can be repeated with a smaller increment.
+		 * @return The number of Newton iterations, or numbers::invalid_unsigned_int if the iteration did not converge
+		 */
+		unsigned int try_load_step ( const MaterialPointLoad<dim> &load )
+		{
+			const Tensor<2,dim> F_n = F;
+			const Tensor<2,dim> P_n = P;
+
+			// The free components of the displacement gradient
+			 unsigned int n_free = 0;
+			 for ( unsigned int i=0; i<dim; i++ )
+				 for ( unsigned int j=0; j<dim; j++ )
+				 {
+					 if ( load.prescribed[i][j] )
+						 F[i][j] += load.Delta_H[i][j];
+					 else
+					 {
+						 free_components[n_free] = std::make_pair(i,j);
+						 n_free++;
+					 }
+				 }
+
+			// Any exception (e.g. a singular tangent in solve or a failing material) also restores the last load step.
+			// The history of the material is only changed by accept, so it is still the one of the last load step.
+			 try
+			 {
+				Tensor<4,dim> A;
+				for ( unsigned int iteration=0; iteration<=max_iter; iteration++ )
+				{
+					material.evaluate( F, P, A );
+
+					double residual_norm = 0;
+					for ( unsigned int k=0; k<n_free; k++ )
+					{
+						residual[k] = - P[free_components[k].first][free_components[k].second];
+						residual_norm += residual[k]*residual[k];
+					}
+					// Relative to the stress magnitude, but at least absolute for (almost) stress-free states
+					 if ( std::sqrt(residual_norm) <= tol * std::max( 1., P.norm() ) )
+					 {
+						 material.accept();
+						 return iteration;
+					 }
+					 else if ( !std::isfinite(residual_norm) || iteration==max_iter )
+						 break;
+
+					for ( unsigned int k=0; k<n_free; k++ )
+						for ( unsigned int l=0; l<n_free; l++ )
+							jacobian[k][l] = A[free_components[k].first][free_components[k].second][free_components[l].first][free_components[l].second];
+					solve( n_free );
+
+					for ( unsigned int k=0; k<n_free; k++ )
+						F[free_components[k].first][free_components[k].second] += residual[k];
+				}
+			 }
+			 catch ( ... )
+			 {
+				F = F_n;
+				P = P_n;
+				throw;
+			 }
+
+			F = F_n;
+			P = P_n;
+			return numbers::invalid_unsigned_int;
+		}
+
+		/**
+		 * Apply all the load steps, e.g. from a parameter identification with many material parameter sets
+		 * @param make_load Callable with the arguments (const unsigned int current_load_step) that returns the \a MaterialPointLoad<dim>
+		 * @param store_state Callable with the arguments (const unsigned int current_load_step, const Tensor<2,dim> &F, const Tensor<2,dim> &P)
+		 */
+		template<typename MakeLoadType, typename StoreStateType>
+		void run ( const unsigned int n_load_steps, const MakeLoadType &make_load, const StoreStateType &store_state )
+		{
+			for ( unsigned int current_load_step=1; current_load_step<=n_load_steps; current_load_step++ )
+			{
+				apply_load_step( make_load(current_load_step) );
+				store_state( current_load_step, F, P );
+			}
+		}
+
+		/**
+		 * Follow the load path of the \a scheduler with adaptive load steps
+		 * @param make_load Callable with the arguments (const double time_last, const double time) that returns the \a MaterialPointLoad<dim>
+		 * @param store_state Callable with the arguments (const double time, const Tensor<2,dim> &F, const Tensor<2,dim> &P)
+		 */
+		template<typename MakeLoadType, typename StoreStateType>
+		void run ( LoadStepScheduler &scheduler, const MakeLoadType &make_load, const StoreStateType &store_state )
+		{
+			while ( !scheduler.finished() )
+			{
+				scheduler.propose_step();
+				const unsigned int n_iterations = try_load_step( make_load( scheduler.get_time_last(), scheduler.get_time() ) );
+				if ( n_iterations == numbers::invalid_unsigned_int )
+					scheduler.reject();
+				else
+				{
+					scheduler.accept( n_iterations );
+					store_state( scheduler.get_time(), F, P );
+				}
+			}
+		}
+
+		const Tensor<2,dim> &get_deformation_gradient () const
+		{
+			return F;
+		}
+
+		/**
+		 * @return The first Piola-Kirchhoff stress of the last accepted load step
+		 */
+		const Tensor<2,dim> &get_stress () const
+		{
+			return P;
+		}
+
+	private:
+		/**
+		 * Solve jacobian * x = residual for the first \a n rows by Gaussian elimination with partial pivoting, the solution overwrites the \a residual.
+		 * The system has at most dim*dim rows, so we avoid any allocation.
+		 */
+		void solve ( const unsigned int n )
+		{
+			for ( unsigned int k=0; k<n; k++ )
+			{
+				unsigned int pivot = k;
+				for ( unsigned int i=k+1; i<n; i++ )
+					if ( std::abs(jacobian[i][k]) > std::abs(jacobian[pivot][k]) )
+						pivot = i;
+				AssertThrow( jacobian[pivot][k] != 0, ExcMessage("MaterialPointDriver<< The tangent of the free components is singular. "
+																  "Maybe the load leaves rigid body rotations free?"));
+				if ( pivot != k )
+				{
+					for ( unsigned int j=0; j<n; j++ )
+						std::swap( jacobian[k][j], jacobian[pivot][j] );
+					std::swap( residual[k], residual[pivot] );
+				}
+
+				for ( unsigned int i=k+1; i<n; i++ )
+				{
+					const double factor = jacobian[i][k] / jacobian[k][k];
+					for ( unsigned int j=k; j<n; j++ )
+						jacobian[i][j] -= factor * jacobian[k][j];
+					residual[i] -= factor * residual[k];
+				}
+			}
+
+			for ( unsigned int k=n; k-- > 0; )
+			{
+				for ( unsigned int j=k+1; j<n; j++ )
+					residual[k] -= jacobian[k][j] * residual[j];
+				residual[k] /= jacobian[k][k];
+			}
+		}
+
+		MaterialType &material;
+		const double tol;
+		const unsigned int max_iter;
+
+		Tensor<2,dim> F;
+		Tensor<2,dim> P;
+
+		std::pair<unsigned int,unsigned int> free_components[dim*dim];
+		double residual[dim*dim];
+		double jacobian[dim*dim][dim*dim];
+	};
+}
+
+#endif // NUMEX_MATERIAL_POINT
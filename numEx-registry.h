@@ -0,0 +1,439 @@
+#ifndef NUMEX_REGISTRY
+#define NUMEX_REGISTRY
+
+// deal.II headers
+#include <deal.II/base/thread_management.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/lac/affine_constraints.h>
+
+// C++ headers
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+#include <memory>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+// Numerical example helper function
+#include "./numEx-helper_fnc.h"
+
+using namespace dealii;
+
+/**
+ * Register the numerical example in the namespace \a example_namespace (e.g. Rod, HyperCube) in the \a registry (numEx::ExampleRegistry<dim>).
+ * The example header has to be included before. The name of the namespace is the name of the example in the registry.
+ * The example has to declare its \a State, which is owned by each \a ExampleInstance of the example.
+ */
+#define NUMEX_REGISTER_EXAMPLE( registry, example_namespace ) \
+	(registry).add( #example_namespace, \
+					numEx::wrap_make_grid< std::remove_reference<decltype(registry)>::type::dimension, example_namespace::State >( \
+						&example_namespace::make_grid< std::remove_reference<decltype(registry)>::type::dimension > ), \
+					numEx::wrap_make_constraints< std::remove_reference<decltype(registry)>::type::dimension, example_namespace::State >( \
+						&example_namespace::make_constraints< std::remove_reference<decltype(registry)>::type::dimension > ) )
+
+namespace numEx
+{
+	/**
+	 * All the arguments any of the \a make_constraints functions of the examples might require.
+	 * Each example only picks the arguments of its own signature (see \a wrap_make_constraints).
+	 */
+	template<int dim>
+	struct ConstraintsArguments
+	{
+		ConstraintsArguments ( AffineConstraints<double> &constraints, const FESystem<dim> &fe, DoFHandler<dim> &dof_handler,
+							   const Parameter::GeneralParameters &parameter )
+		:
+		constraints(constraints),
+		fe(fe),
+		dof_handler(dof_handler),
+		parameter(parameter),
+		n_components(fe.n_components())
+		{
+		}
+
+		AffineConstraints<double> &constraints;
+		const FESystem<dim> &fe;
+		DoFHandler<dim> &dof_handler;
+		const Parameter::GeneralParameters &parameter;
+
+		unsigned int n_components;
+		bool apply_dirichlet_bc = true;
+		double load_increment = 0.;
+		// Only for some examples: the current load state (Beam), the load step (HyperCube_shear), the list of boundary ids (ThreePointBeam)
+		 double lambda_n = 0.;
+		 unsigned int load_step = 0;
+		 std::vector<unsigned int> boundary_id_collection;
+	};
+
+	template<int dim, typename StateType>
+	using MakeGridFunction = std::function<void( Triangulation<dim>&, const Parameter::GeneralParameters&, const std::vector<unsigned int>&, StateType& )>;
+
+	template<int dim, typename StateType>
+	using MakeConstraintsFunction = std::function<void( ConstraintsArguments<dim>&, StateType& )>;
+
+	// The different signatures of make_grid used by the examples,
+	// the examples without a \a State argument do not modify the state of the instance
+	 template<int dim, typename StateType>
+	 MakeGridFunction<dim,StateType> wrap_make_grid ( void (*make_grid)( Triangulation<dim>&, const Parameter::GeneralParameters& ) )
+	 {
+		 return [make_grid] ( Triangulation<dim> &triangulation, const Parameter::GeneralParameters &parameter, const std::vector<unsigned int>&, StateType& )
+				{ make_grid( triangulation, parameter ); };
+	 }
+
+	 template<int dim, typename StateType>
+	 MakeGridFunction<dim,StateType> wrap_make_grid ( void (*make_grid)( Triangulation<dim>&, const Parameter::GeneralParameters&, std::vector<unsigned int> ) )
+	 {
+		 return [make_grid] ( Triangulation<dim> &triangulation, const Parameter::GeneralParameters &parameter, const std::vector<unsigned int> &boundary_id_collection, StateType& )
+				{ make_grid( triangulation, parameter, boundary_id_collection ); };
+	 }
+
+	 // With the state (e.g. Rod, HyperCube)
+	 template<int dim, typename StateType>
+	 MakeGridFunction<dim,StateType> wrap_make_grid ( void (*make_grid)( Triangulation<dim>&, const Parameter::GeneralParameters&, StateType& ) )
+	 {
+		 return [make_grid] ( Triangulation<dim> &triangulation, const Parameter::GeneralParameters &parameter, const std::vector<unsigned int>&, StateType &state )
+				{ make_grid( triangulation, parameter, state ); };
+	 }
+
+	// The different signatures of make_constraints used by the examples
+	 // Standard (e.g. Rod, tensileSpecimen, Miyauchi_shear)
+	 template<int dim, typename StateType>
+	 MakeConstraintsFunction<dim,StateType> wrap_make_constraints ( void (*make_constraints)( AffineConstraints<double>&, const FESystem<dim>&, unsigned int&, DoFHandler<dim>&,
+																							  const bool&, double&, const Parameter::GeneralParameters& ) )
+	 {
+		 return [make_constraints] ( ConstraintsArguments<dim> &args, StateType& )
+				{ make_constraints( args.constraints, args.fe, args.n_components, args.dof_handler, args.apply_dirichlet_bc, args.load_increment, args.parameter ); };
+	 }
+
+	 // Constant load increment (e.g. PlateWithAHole, QuarterHyperCube_Merged)
+	 template<int dim, typename StateType>
+	 MakeConstraintsFunction<dim,StateType> wrap_make_constraints ( void (*make_constraints)( AffineConstraints<double>&, const FESystem<dim>&, unsigned int&, DoFHandler<dim>&,
+																							  const bool&, const double&, const Parameter::GeneralParameters& ) )
+	 {
+		 return [make_constraints] ( ConstraintsArguments<dim> &args, StateType& )
+				{ make_constraints( args.constraints, args.fe, args.n_components, args.dof_handler, args.apply_dirichlet_bc, args.load_increment, args.parameter ); };
+	 }
+
+	 // Without the number of components (HyperRectangle)
+	 template<int dim, typename StateType>
+	 MakeConstraintsFunction<dim,StateType> wrap_make_constraints ( void (*make_constraints)( AffineConstraints<double>&, const FESystem<dim>&, DoFHandler<dim>&,
+																							  const bool&, double&, const Parameter::GeneralParameters& ) )
+	 {
+		 return [make_constraints] ( ConstraintsArguments<dim> &args, StateType& )
+				{ make_constraints( args.constraints, args.fe, args.dof_handler, args.apply_dirichlet_bc, args.load_increment, args.parameter ); };
+	 }
+
+	 // Without the number of components, with the state (HyperCube)
+	 template<int dim, typename StateType>
+	 MakeConstraintsFunction<dim,StateType> wrap_make_constraints ( void (*make_constraints)( AffineConstraints<double>&, const FESystem<dim>&, DoFHandler<dim>&,
+																							  const bool&, double&, const Parameter::GeneralParameters&, StateType& ) )
+	 {
+		 return [make_constraints] ( ConstraintsArguments<dim> &args, StateType &state )
+				{ make_constraints( args.constraints, args.fe, args.dof_handler, args.apply_dirichlet_bc, args.load_increment, args.parameter, state ); };
+	 }
+
+	 // With the load step and the state (HyperCube_shear, Unconstrained_elastoplastic_test)
+	 template<int dim, typename StateType>
+	 MakeConstraintsFunction<dim,StateType> wrap_make_constraints ( void (*make_constraints)( AffineConstraints<double>&, const FESystem<dim>&, DoFHandler<dim>&,
+																							  const bool&, double&, const Parameter::GeneralParameters&, unsigned int, StateType& ) )
+	 {
+		 return [make_constraints] ( ConstraintsArguments<dim> &args, StateType &state )
+				{ make_constraints( args.constraints, args.fe, args.dof_handler, args.apply_dirichlet_bc, args.load_increment, args.parameter, args.load_step, state ); };
+	 }
+
+	 // With the load state and the state (Beam)
+	 template<int dim, typename StateType>
+	 MakeConstraintsFunction<dim,StateType> wrap_make_constraints ( void (*make_constraints)( AffineConstraints<double>&, const FESystem<dim>&, unsigned int&, DoFHandler<dim>&,
+																							  const bool&, double&, const double&, const Parameter::GeneralParameters&, StateType& ) )
+	 {
+		 return [make_constraints] ( ConstraintsArguments<dim> &args, StateType &state )
+				{ make_constraints( args.constraints, args.fe, args.n_components, args.dof_handler, args.apply_dirichlet_bc, args.load_increment, args.lambda_n, args.parameter, state ); };
+	 }
+
+	 // With the list of boundary ids (e.g. ThreePointBeam, TensileCompression, Rod_uniform)
+	 template<int dim, typename StateType>
+	 MakeConstraintsFunction<dim,StateType> wrap_make_constraints ( void (*make_constraints)( AffineConstraints<double>&, const FESystem<dim>&, unsigned int&, DoFHandler<dim>&,
+																							  const bool&, double&, const Parameter::GeneralParameters&, std::vector<unsigned int> ) )
+	 {
+		 return [make_constraints] ( ConstraintsArguments<dim> &args, StateType& )
+				{ make_constraints( args.constraints, args.fe, args.n_components, args.dof_handler, args.apply_dirichlet_bc, args.load_increment, args.parameter, args.boundary_id_collection ); };
+	 }
+
+	 // Without the parameters, with the state (SphereRigid-cube_contact)
+	 template<int dim, typename StateType>
+	 MakeConstraintsFunction<dim,StateType> wrap_make_constraints ( void (*make_constraints)( AffineConstraints<double>&, const FESystem<dim>&, unsigned int&, DoFHandler<dim>&,
+																							  const bool&, double&, StateType& ) )
+	 {
+		 return [make_constraints] ( ConstraintsArguments<dim> &args, StateType &state )
+				{ make_constraints( args.constraints, args.fe, args.n_components, args.dof_handler, args.apply_dirichlet_bc, args.load_increment, state ); };
+	 }
+
+	template<int dim, typename StateType>
+	class ExampleInstanceOf;
+
+	/**
+	 * One instance of a numerical example behind the common interface of the \a ExampleRegistry.
+	 * The instance owns the \a State of the example, i.e. the variables that \a make_grid and \a make_constraints set
+	 * (e.g. body_dimensions, eval_points_list, the rigid contact bodies), and passes it explicitly to these functions.
+	 * Hence, several instances of the same example (e.g. different parameter sets) can be used at the same time on different threads.
+	 * The functions that only read the state (e.g. the contact assembly of SphereRigid_Cube) are called directly with \a get_state, e.g.
+	 * @code
+	 * std::unique_ptr<numEx::ExampleInstance<dim>> instance = registry.get("SphereRigid_Cube").create_instance();
+	 * instance->make_grid( triangulation, parameter, boundary_id_collection );
+	 * SphereRigid_Cube::assemble_contact<dim>( ..., instance->get_state<SphereRigid_Cube::State>() );
+	 * @endcode
+	 * The example functions can also be called without the registry with an own \a State, e.g. Rod::make_grid<dim>( triangulation, parameter, rod_state ).
+	 * Without a \a State argument, they use the \a example_state of the example, which is also accessible via the familiar names (e.g. Rod::eval_points_list).
+	 */
+	template<int dim>
+	class ExampleInstance
+	{
+	public:
+		ExampleInstance ( const std::string &name )
+		:
+		name(name)
+		{
+		}
+
+		virtual ~ExampleInstance () = default;
+
+		virtual void make_grid ( Triangulation<dim> &triangulation, const Parameter::GeneralParameters &parameter,
+								 const std::vector<unsigned int> &boundary_id_collection ) = 0;
+
+		virtual void make_constraints ( ConstraintsArguments<dim> &arguments ) = 0;
+
+		/**
+		 * @return The state of this instance, where \a StateType has to be the \a State of the example (e.g. Rod::State)
+		 */
+		template<typename StateType>
+		StateType &get_state ()
+		{
+			ExampleInstanceOf<dim,StateType> *instance = dynamic_cast< ExampleInstanceOf<dim,StateType>* >( this );
+			AssertThrow( instance != nullptr, ExcMessage("ExampleInstance<< The requested state does not belong to the example "+name+".") );
+			return instance->state;
+		}
+
+		const std::string name;
+	};
+
+	/**
+	 * The \a ExampleInstance of an example with the state \a StateType
+	 */
+	template<int dim, typename StateType>
+	class ExampleInstanceOf : public ExampleInstance<dim>
+	{
+	public:
+		ExampleInstanceOf ( const std::string &name, const MakeGridFunction<dim,StateType> &make_grid_function,
+							const MakeConstraintsFunction<dim,StateType> &make_constraints_function )
+		:
+		ExampleInstance<dim>(name),
+		make_grid_function(make_grid_function),
+		make_constraints_function(make_constraints_function)
+		{
+		}
+
+		void make_grid ( Triangulation<dim> &triangulation, const Parameter::GeneralParameters &parameter,
+						 const std::vector<unsigned int> &boundary_id_collection ) override
+		{
+			make_grid_function( triangulation, parameter, boundary_id_collection, state );
+		}
+
+		void make_constraints ( ConstraintsArguments<dim> &arguments ) override
+		{
+			make_constraints_function( arguments, state );
+		}
+
+		StateType state;
+
+	private:
+		const MakeGridFunction<dim,StateType> make_grid_function;
+		const MakeConstraintsFunction<dim,StateType> make_constraints_function;
+	};
+
+	/**
+	 * A numerical example in the \a ExampleRegistry, which creates the instances of the example
+	 */
+	template<int dim>
+	struct ExampleEntry
+	{
+		std::string name;
+		std::function< std::unique_ptr<ExampleInstance<dim>>() > create_instance;
+	};
+
+	/**
+	 * Registry of the numerical examples, so the driver can select an example by its name at runtime
+	 * instead of being recompiled or branched for each example.
+	 * Register the examples via NUMEX_REGISTER_EXAMPLE( registry, Rod ), which adapts the different signatures
+	 * of make_grid and make_constraints. Create an instance of an example via registry.get( name ).create_instance().
+	 */
+	template<int dim>
+	class ExampleRegistry
+	{
+	public:
+		static const int dimension = dim;
+
+		template<typename StateType>
+		void add ( const std::string &name, const MakeGridFunction<dim,StateType> &make_grid, const MakeConstraintsFunction<dim,StateType> &make_constraints )
+		{
+			ExampleEntry<dim> entry;
+			entry.name = name;
+			entry.create_instance = [name, make_grid, make_constraints] ()
+									{ return std::unique_ptr<ExampleInstance<dim>>( new ExampleInstanceOf<dim,StateType>( name, make_grid, make_constraints ) ); };
+			examples[name] = entry;
+		}
+
+		const ExampleEntry<dim> &get ( const std::string &name ) const
+		{
+			typename std::map< std::string, ExampleEntry<dim> >::const_iterator entry = examples.find(name);
+			if ( entry == examples.end() )
+			{
+				std::string available;
+				for ( typename std::map< std::string, ExampleEntry<dim> >::const_iterator it = examples.begin(); it != examples.end(); ++it )
+					available += " " + it->first;
+				AssertThrow( false, ExcMessage("ExampleRegistry<< The numerical example "+name+" is not registered. Available examples:"+available));
+			}
+			return entry->second;
+		}
+
+		std::vector<std::string> get_names () const
+		{
+			std::vector<std::string> names;
+			for ( typename std::map< std::string, ExampleEntry<dim> >::const_iterator it = examples.begin(); it != examples.end(); ++it )
+				names.push_back( it->first );
+			return names;
+		}
+
+	private:
+		std::map< std::string, ExampleEntry<dim> > examples;
+	};
+
+	/**
+	 * Runs many (example, parameter set) jobs as tasks inside one process, so MPI, TBB and the registry are only set up once.
+	 * Each job gets its own \a ExampleInstance, so all jobs (also those of the same example) run in parallel on the thread pool of deal.II (TBB).
+	 * Work that all jobs of one example share (e.g. reading a mesh or precomputing tables) can be done once per example
+	 * by a setup function, whose result is handed to each job of this example.
+	 * The boundary DoF cache of \a BC_apply is kept per thread and is reset whenever it sees the DoFHandler of another job.
+	 */
+	template<int dim>
+	class SweepExecutor
+	{
+	public:
+		SweepExecutor ( const ExampleRegistry<dim> &registry )
+		:
+		registry(registry)
+		{
+		}
+
+		/**
+		 * @return The index of the job, which is also its index in the list of errors returned by \a run
+		 */
+		unsigned int add_job ( const std::string &name, const Parameter::GeneralParameters &parameter )
+		{
+			// Check the name now instead of when the job is running
+			 registry.get( name );
+
+			jobs.push_back( std::make_pair( name, parameter ) );
+			return jobs.size()-1;
+		}
+
+		/**
+		 * Run all jobs and remove them from the executor
+		 * @param job Callable with the arguments (ExampleInstance<dim>&, const Parameter::GeneralParameters&, const unsigned int job_index),
+		 * e.g. make_grid, setup and solve of the example
+		 * @return For each job the message of the exception that stopped it or an empty string if the job finished
+		 */
+		template<typename JobType>
+		std::vector<std::string> run ( const JobType &job )
+		{
+			return run( [] ( const ExampleEntry<dim>& ) { return true; },
+						[&job] ( ExampleInstance<dim> &instance, const bool&, const Parameter::GeneralParameters &parameter, const unsigned int job_index )
+						{ job( instance, parameter, job_index ); } );
+		}
+
+		/**
+		 * Run all jobs and remove them from the executor, where the \a setup is done once for each example
+		 * @param setup Callable with the argument (const ExampleEntry<dim>&), which returns the result of the setup that the jobs of this example share
+		 * @param job Callable with the arguments (ExampleInstance<dim>&, const SetupResultType&, const Parameter::GeneralParameters&, const unsigned int job_index)
+		 * @return For each job the message of the exception that stopped it (or its setup) or an empty string if the job finished
+		 */
+		template<typename SetupType, typename JobType>
+		std::vector<std::string> run ( const SetupType &setup, const JobType &job )
+		{
+			typedef typename std::decay< decltype( setup( std::declval<const ExampleEntry<dim>&>() ) ) >::type SetupResultType;
+
+			std::vector<std::string> errors ( jobs.size() );
+
+			// Setup of each example, in parallel for the different examples
+			 std::map< std::string, std::unique_ptr<SetupResultType> > setup_results;
+			 std::map< std::string, std::string > setup_errors;
+			 for ( unsigned int i=0; i<jobs.size(); i++ )
+			 {
+				 setup_results[ jobs[i].first ];
+				 setup_errors[ jobs[i].first ];
+			 }
+			 {
+				Threads::TaskGroup<void> setup_tasks;
+				for ( typename std::map< std::string, std::unique_ptr<SetupResultType> >::iterator it = setup_results.begin(); it != setup_results.end(); ++it )
+				{
+					const ExampleEntry<dim> &example = registry.get( it->first );
+					std::unique_ptr<SetupResultType> &setup_result = it->second;
+					std::string &setup_error = setup_errors[ it->first ];
+					setup_tasks += Threads::new_task( [&setup, &example, &setup_result, &setup_error] ()
+													  {
+														try
+														{
+															setup_result.reset( new SetupResultType( setup( example ) ) );
+														}
+														catch ( const std::exception &exc )
+														{
+															setup_error = "Setup of "+example.name+" failed: "+exc.what();
+														}
+													  } );
+				}
+				setup_tasks.join_all();
+			 }
+
+			// One task per job, each with its own instance of the example
+			 Threads::TaskGroup<void> tasks;
+			 for ( unsigned int i=0; i<jobs.size(); i++ )
+			 {
+				// The jobs of an example whose setup failed are not started
+				 if ( setup_results[ jobs[i].first ] == nullptr )
+				 {
+					 errors[i] = setup_errors[ jobs[i].first ];
+					 continue;
+				 }
+
+				const ExampleEntry<dim> &example = registry.get( jobs[i].first );
+				const SetupResultType &setup_result = *setup_results[ jobs[i].first ];
+				tasks += Threads::new_task( [this, &job, &example, &setup_result, &errors, i] ()
+											{
+												// Each job writes only into its own entry of the errors
+												 try
+												 {
+													std::unique_ptr<ExampleInstance<dim>> instance = example.create_instance();
+													job( *instance, setup_result, jobs[i].second, i );
+												 }
+												 catch ( const std::exception &exc )
+												 {
+													errors[i] = exc.what();
+												 }
+											} );
+			 }
+			 tasks.join_all();
+
+			jobs.clear();
+			return errors;
+		}
+
+	private:
+		const ExampleRegistry<dim> &registry;
+		std::vector< std::pair<std::string,Parameter::GeneralParameters> > jobs;
+	};
+}
+
+#endif // NUMEX_REGISTRY
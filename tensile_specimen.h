@@ -29,6 +29,9 @@ namespace tensileSpecimen
 	 const enums::enum_boundary_ids id_boundary_load = enums::id_boundary_xPlus;
 	 //const enums::enum_boundary_ids id_boundary_secondaryLoad = enums::id_boundary_yPlus;
 
+	// Stateless example, the instances have an empty state (see numEx::ExampleInstance)
+	 struct State {};
+
 	// Desired overall length
 	// @todo Currently hardcoded, should be a parameter
 	 const double desired_length = 70.; // SEP1230: 70, A50: 84
@@ -154,6 +157,10 @@ namespace tensileSpecimen
 		 // @todo Maybe we want to align the specimen in y-direction, so we would have to change the enums::x .. accessors accordingly
 		 repetitions[enums::x] = parameter.grid_y_repetitions;
 		 repetitions[enums::y] = 2; // minimum for compatibility with prerefined radial parts
+		 // @todo A minimal coarse mesh (as \a numEx::create_merged_bricks for the bricks of e.g. the Beam) would require the radial parts
+		 // without their pre-refinement, which is currently needed to assign the manifolds only to the radii (see below).
+		 // Moreover, the "global" refinements of the 3D mesh are anisotropic (cut_xy), so they do not give a level hierarchy for
+		 // geometric multigrid anyway.
 
 		Triangulation<2> central_rectangular_part;
 		GridGenerator::subdivided_hyper_rectangle
@@ -383,6 +390,50 @@ namespace tensileSpecimen
 
 
 	// 2D grid
+	/**
+	 * Center points of the transition radii (lower: x<0, upper: x>0), such that the radii are tangential to the parallel area
+	 */
+	inline Point<2> get_radius_center( const Parameter::GeneralParameters &parameter, const bool upper )
+	{
+		Point<2> radius_center;
+		radius_center[enums::x] = ( upper ? 1. : -1. ) * parameter.height/2.;
+		radius_center[enums::y] = parameter.notchWidth/2. + parameter.holeRadius;
+		return radius_center;
+	}
+
+	/**
+	 * Attach the manifolds to both transition radii (also needed after loading the mesh from the \a numEx::MeshCache)
+	 */
+	template <int dim>
+	void attach_manifolds( Triangulation<2> &triangulation, const Parameter::GeneralParameters &parameter )
+	{
+		parameterCollection parameters_internal;
+
+		SphericalManifold<dim> spherical_manifold_upper ( get_radius_center(parameter,true) );
+		triangulation.set_manifold(parameters_internal.manifold_id_radius_upper, spherical_manifold_upper);
+
+		SphericalManifold<dim> spherical_manifold_lower ( get_radius_center(parameter,false) );
+		triangulation.set_manifold(parameters_internal.manifold_id_radius_lower, spherical_manifold_lower);
+	}
+
+	template <int dim>
+	void attach_manifolds( Triangulation<3> &triangulation, const Parameter::GeneralParameters &parameter )
+	{
+		parameterCollection parameters_internal;
+
+		Tensor<1,dim> cylinder_axis;
+		cylinder_axis[enums::z] = 1;
+
+		const Point<2> upper_radius_center = get_radius_center(parameter,true);
+		const Point<2> lower_radius_center = get_radius_center(parameter,false);
+
+		CylindricalManifold<dim> cylindrical_manifold_upper (cylinder_axis, Point<dim>(upper_radius_center[enums::x],upper_radius_center[enums::y],0));
+		triangulation.set_manifold(parameters_internal.manifold_id_radius_upper, cylindrical_manifold_upper);
+
+		CylindricalManifold<dim> cylindrical_manifold_lower (cylinder_axis, Point<dim>(lower_radius_center[enums::x],lower_radius_center[enums::y],0));
+		triangulation.set_manifold(parameters_internal.manifold_id_radius_lower, cylindrical_manifold_lower);
+	}
+
 	template <int dim>
 	void make_grid( Triangulation<2> &triangulation, const Parameter::GeneralParameters &parameter )
 	{
@@ -426,69 +477,36 @@ namespace tensileSpecimen
 		 //double upper_end = + ( length_parallel/2. + transition_radius + hwidth_b + extension_upper );
 		 double upper_end = desired_length/2.;
 
-		// Set boundary IDs and and manifolds
-		for (typename Triangulation<dim>::active_cell_iterator
-			 cell = triangulation.begin_active();
-			 cell != triangulation.end(); ++cell)
-		{
-			for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-			  if (cell->face(face)->at_boundary())
-			  {
-				// Set boundary IDs
-				// lower end
-				if (std::abs(cell->face(face)->center()[enums::x] - lower_end) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_xMinus);
-				}
-				// upper end
-				else if (std::abs(cell->face(face)->center()[enums::x] - upper_end) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_xPlus);
-				}
-				// y0 (symmetry)
-				else if (std::abs(cell->face(face)->center()[enums::y] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yMinus);
-				}
-				else
-				{
-					for (unsigned int vertex=0; vertex<GeometryInfo<dim>::vertices_per_face; ++vertex)
-					{
-					 // Project the cell vertex to the XY plane and test the distance from the cylinder axis
-						Point<dim> current_vertex = cell->face(face)->vertex(vertex);
-						// If the point lies above the inner parallel area ...
-						if ( current_vertex[enums::x] > ( length_parallel/2. + 5.*search_tolerance ) )
-						{
-							// ... and the radius fits to transition radius
-							if ( std::abs(current_vertex.distance(upper_radius_center) - transition_radius) < search_tolerance )
-							{
-								cell->face(face)->set_boundary_id(parameters_internal.boundary_id_radius_upper);
-								cell->face(face)->set_all_manifold_ids(parameters_internal.manifold_id_radius_upper);
-								break;
-							}
-						}
-						// If the point lies below the inner parallel area ...
-						else if ( current_vertex[enums::x] < - ( length_parallel/2. + 5.*search_tolerance ) )
-						{
-							// ... and the radius fits to transition radius
-							if ( std::abs(current_vertex.distance(lower_radius_center) - transition_radius) < search_tolerance )
-							{
-								cell->face(face)->set_boundary_id(parameters_internal.boundary_id_radius_lower);
-								cell->face(face)->set_all_manifold_ids(parameters_internal.manifold_id_radius_lower);
-								break;
-							}
-						}
-					}
-				}
-			  }
-		}
+		// Boundary IDs of the ends, the symmetry plane and both transition radii of the 2D specimen
+		 const double max_coord = std::numeric_limits<double>::max();
+		 numEx::BoundaryClassifier<dim> boundary_classifier ( search_tolerance );
+		 boundary_classifier.add_plane( enums::x, lower_end, enums::id_boundary_xMinus )	// lower end
+							.add_plane( enums::x, upper_end, enums::id_boundary_xPlus )	// upper end
+							.add_plane( enums::y, 0.0, enums::id_boundary_yMinus )	// y0 (symmetry)
+							// A vertex above the inner parallel area lies on the transition radius
+							.add_sphere( Point<3>(upper_radius_center[enums::x],upper_radius_center[enums::y],0), transition_radius,
+										 parameters_internal.boundary_id_radius_upper, numEx::BoundaryClassifier<dim>::test_any_vertex )
+							.restrict_to_box( Point<3>(length_parallel/2. + 5.*search_tolerance,-max_coord,-max_coord), Point<3>(max_coord,max_coord,max_coord) )
+							// A vertex below the inner parallel area lies on the transition radius
+							.add_sphere( Point<3>(lower_radius_center[enums::x],lower_radius_center[enums::y],0), transition_radius,
+										 parameters_internal.boundary_id_radius_lower, numEx::BoundaryClassifier<dim>::test_any_vertex )
+							.restrict_to_box( Point<3>(-max_coord,-max_coord,-max_coord), Point<3>(-(length_parallel/2. + 5.*search_tolerance),max_coord,max_coord) );
+		 boundary_classifier.apply( triangulation, /*clear_existing_IDs*/false );
+
+		// Set the manifold IDs of the faces on both radii
+		 for ( typename Triangulation<dim>::active_face_iterator
+			   face = triangulation.begin_active_face();
+			   face != triangulation.end_face(); ++face )
+			 if ( face->at_boundary() )
+			 {
+				 if ( face->boundary_id() == parameters_internal.boundary_id_radius_upper )
+					 face->set_all_manifold_ids(parameters_internal.manifold_id_radius_upper);
+				 else if ( face->boundary_id() == parameters_internal.boundary_id_radius_lower )
+					 face->set_all_manifold_ids(parameters_internal.manifold_id_radius_lower);
+			 }
 
 		// Apply cylindrical manifolds to both radii
-		 SphericalManifold<dim> spherical_manifold_upper ( upper_radius_center);
-		 triangulation.set_manifold(parameters_internal.manifold_id_radius_upper, spherical_manifold_upper);
-
-		 SphericalManifold<dim> spherical_manifold_lower ( lower_radius_center);
-		 triangulation.set_manifold(parameters_internal.manifold_id_radius_lower, spherical_manifold_lower);
+		 attach_manifolds<dim>( triangulation, parameter );
 
 		// Notch the parallel area in the middle
 		 // Find the nodes (plural because of thickness) at x=0 and shift them down by 0.5% of the hwidth_b
@@ -509,24 +527,22 @@ namespace tensileSpecimen
 		 triangulation.refine_global(parameter.nbr_global_refinements);
 
 		// Refine the cells in the parallel part
+		// The band narrows with each refinement, so only the children of the refined cells need to be tested again
+		 numEx::RefinementRegion<dim> refinement_region ( triangulation );
 		 for ( unsigned int nbr_local_ref=0; nbr_local_ref < parameter.nbr_holeEdge_refinements; nbr_local_ref++ )
 		 {
-			for (typename Triangulation<dim>::active_cell_iterator
-						 cell = triangulation.begin_active();
-						 cell != triangulation.end(); ++cell)
-			{
-				for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-					// Find all cells that lay in an exemplary damage band with size 1.5 mm from the y=0 face
-					if ( std::abs( cell->face(face)->center()[enums::x] ) <= ( length_parallel/(4.+3.*double(nbr_local_ref) ) ) )
-					{
-						if ( nbr_local_ref==1 || nbr_local_ref==3 || nbr_local_ref==5 || nbr_local_ref==7 ) // even
-							cell->set_refine_flag();
-						else
-							cell->set_refine_flag(RefinementCase<dim>::cut_x); // refine only in the x-direction
-						break;
-					}
-			}
-			triangulation.execute_coarsening_and_refinement();
+			const double band_half_width = length_parallel/(4.+3.*double(nbr_local_ref));
+			refinement_region.refine( [&] ( const typename Triangulation<dim>::active_cell_iterator &cell )
+									  {
+										  for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
+											  // Find all cells that lay in an exemplary damage band with size 1.5 mm from the y=0 face
+											  if ( std::abs( cell->face(face)->center()[enums::x] ) <= band_half_width )
+												  return true;
+										  return false;
+									  },
+									  ( nbr_local_ref==1 || nbr_local_ref==3 || nbr_local_ref==5 || nbr_local_ref==7 ) // even
+									  ? RefinementCase<dim>::isotropic_refinement
+									  : RefinementCase<dim>::cut_x ); // refine only in the x-direction
 		 }
 
 		// include the following two scopes to see directly how the variation of the input parameters changes the geometry of the grid
@@ -557,8 +573,11 @@ namespace tensileSpecimen
 
 
 // 3d grid
+	/**
+	 * Build the conforming 3D coarse mesh on the serial triangulation \a tria_coarse, see \a make_grid
+	 */
 	template <int dim>
-	void make_grid( Triangulation<3> &triangulation, const Parameter::GeneralParameters &parameter )
+	void make_coarse_grid( Triangulation<3> &tria_coarse, const Parameter::GeneralParameters &parameter )
 	{
 		parameterCollection parameters_internal;
 		
@@ -617,7 +636,7 @@ namespace tensileSpecimen
 		 GridGenerator::extrude_triangulation( triangulation_2D,
 										   	   parameter.nbr_elementsInZ + 1,
 											   hthickness,
-											   triangulation );
+											   tria_coarse );
 		
 		// ************************************************************************************************************	
 	    // From now on 3D
@@ -636,95 +655,68 @@ namespace tensileSpecimen
 			lower_radius_center_3D[i] = lower_radius_center[i];
 		 }
 		
-		// Set boundary IDs and and manifolds
-		for (typename Triangulation<dim>::active_cell_iterator
-			 cell = triangulation.begin_active();
-			 cell != triangulation.end(); ++cell)
-		{
-			for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-			  if (cell->face(face)->at_boundary())
-			  {
-				// Set boundary IDs
-				// lower end
-				if (std::abs(cell->face(face)->center()[enums::x] - lower_end) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_xMinus);
-				}
-				// upper end
-				else if (std::abs(cell->face(face)->center()[enums::x] - upper_end) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_xPlus);
-				}
-				// y0 (symmetry)
-				else if (std::abs(cell->face(face)->center()[enums::y] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_yMinus);
-				}
-				else if (std::abs(cell->face(face)->center()[2] - 0.0) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_zMinus);
-				}
-				else if (std::abs(cell->face(face)->center()[2] - hthickness) < search_tolerance)
-				{
-					cell->face(face)->set_boundary_id(enums::id_boundary_zPlus);
-				}
-				else
-				{
-					for (unsigned int vertex=0; vertex<GeometryInfo<dim>::vertices_per_face; ++vertex)
-					{
-					 // Project the cell vertex to the XY plane and test the distance from the cylinder axis
-						Point<dim> vertex_proj = cell->face(face)->vertex(vertex);
-						vertex_proj[enums::z] = 0.0;
-						// If the point lies above the inner parallel area ...
-						if ( vertex_proj[enums::x] > ( length_parallel/2. + 5.*search_tolerance ) )
-						{
-							// ... and the radius fits to transition radius
-							if ( std::abs(vertex_proj.distance(upper_radius_center_3D) - transition_radius) < search_tolerance )
-							{
-								cell->face(face)->set_boundary_id(parameters_internal.boundary_id_radius_upper);
-								cell->face(face)->set_all_manifold_ids(parameters_internal.manifold_id_radius_upper);
-								break;
-							}
-						}
-						// If the point lies below the inner parallel area ...
-						else if ( vertex_proj[enums::x] < - ( length_parallel/2. + 5.*search_tolerance ) )
-						{
-							// ... and the radius fits to transition radius
-							if ( std::abs(vertex_proj.distance(lower_radius_center_3D) - transition_radius) < search_tolerance )
-							{
-								cell->face(face)->set_boundary_id(parameters_internal.boundary_id_radius_lower);
-								cell->face(face)->set_all_manifold_ids(parameters_internal.manifold_id_radius_lower);
-								break;
-							}
-						}
-					}
-				}
-			  }
-		}
+		// Boundary IDs of the ends, the symmetry planes, the top face and both transition radii
+		 const double max_coord = std::numeric_limits<double>::max();
+		 numEx::BoundaryClassifier<dim> boundary_classifier ( search_tolerance );
+		 boundary_classifier.add_plane( enums::x, lower_end, enums::id_boundary_xMinus )	// lower end
+							.add_plane( enums::x, upper_end, enums::id_boundary_xPlus )	// upper end
+							.add_plane( enums::y, 0.0, enums::id_boundary_yMinus )	// y0 (symmetry)
+							.add_plane( enums::z, 0.0, enums::id_boundary_zMinus )
+							.add_plane( enums::z, hthickness, enums::id_boundary_zPlus )
+							// A vertex above the inner parallel area lies on the transition radius (distance from the cylinder axis)
+							.add_cylinder( enums::z, transition_radius, parameters_internal.boundary_id_radius_upper, upper_radius_center_3D,
+										   numEx::BoundaryClassifier<dim>::test_any_vertex )
+							.restrict_to_box( Point<3>(length_parallel/2. + 5.*search_tolerance,-max_coord,-max_coord), Point<3>(max_coord,max_coord,max_coord) )
+							// A vertex below the inner parallel area lies on the transition radius
+							.add_cylinder( enums::z, transition_radius, parameters_internal.boundary_id_radius_lower, lower_radius_center_3D,
+										   numEx::BoundaryClassifier<dim>::test_any_vertex )
+							.restrict_to_box( Point<3>(-max_coord,-max_coord,-max_coord), Point<3>(-(length_parallel/2. + 5.*search_tolerance),max_coord,max_coord) );
+		 boundary_classifier.apply( tria_coarse, /*clear_existing_IDs*/false );
+
+		// Set the manifold IDs of the faces on both radii
+		 for ( typename Triangulation<dim>::active_face_iterator
+			   face = tria_coarse.begin_active_face();
+			   face != tria_coarse.end_face(); ++face )
+			 if ( face->at_boundary() )
+			 {
+				 if ( face->boundary_id() == parameters_internal.boundary_id_radius_upper )
+					 face->set_all_manifold_ids(parameters_internal.manifold_id_radius_upper);
+				 else if ( face->boundary_id() == parameters_internal.boundary_id_radius_lower )
+					 face->set_all_manifold_ids(parameters_internal.manifold_id_radius_lower);
+			 }
 
 		// Apply cylindrical manifolds to both radii
-		 Tensor<1,dim> cylinder_axis;
-		 cylinder_axis[enums::z] = 1;
-
-		 CylindricalManifold<dim> cylindrical_manifold_upper (cylinder_axis, upper_radius_center_3D);
-		 triangulation.set_manifold(parameters_internal.manifold_id_radius_upper, cylindrical_manifold_upper);
-
-		 CylindricalManifold<dim> cylindrical_manifold_lower (cylinder_axis, lower_radius_center_3D);
-		 triangulation.set_manifold(parameters_internal.manifold_id_radius_lower, cylindrical_manifold_lower);
+		 attach_manifolds<dim>( tria_coarse, parameter );
 
 		 // "Global" refinements are done solely in the xy-plane
 		  for ( unsigned int nbr_gl_ref=0; nbr_gl_ref < parameter.nbr_global_refinements; nbr_gl_ref++ )
 		  {
 			for (typename Triangulation<dim>::active_cell_iterator
-						 cell = triangulation.begin_active();
-						 cell != triangulation.end(); ++cell)
+						 cell = tria_coarse.begin_active();
+						 cell != tria_coarse.end(); ++cell)
 			{
 				cell->set_refine_flag(RefinementCase<dim>::cut_xy); // refine in x and y-direction
 			}
-			triangulation.execute_coarsening_and_refinement();
+			tria_coarse.execute_coarsening_and_refinement();
 		  }
 		 //triangulation.refine_global(parameter.nbr_global_refinements);
 
+		// Output the triangulation as eps or inp
+		 //numEx::output_triangulation( triangulation, enums::output_eps, numEx_name );
+	}
+
+	/**
+	 * Refine the parallel part of the conforming coarse mesh from \a make_coarse_grid locally by \a refinement_case.
+	 * Only the locally owned cells are flagged, so this also works on a distributed \a triangulation.
+	 */
+	template <int dim>
+	void refine_parallel_part( Triangulation<3> &triangulation, const Parameter::GeneralParameters &parameter,
+							   const RefinementCase<dim> &refinement_case )
+	{
+		parameterCollection parameters_internal;
+		const double search_tolerance = parameters_internal.search_tolerance;
+		const double hwidth_b = parameter.notchWidth/2.;
+
 		 // @todo check the use of only anisotropic xy refinements to keep the thickness direction
 		// Refine the cells in the parallel part
 		// Once refine by cut_x
@@ -732,13 +724,15 @@ namespace tensileSpecimen
 					 cell = triangulation.begin_active();
 					 cell != triangulation.end(); ++cell)
 		 {
+			if ( !cell->is_locally_owned() )
+				continue;
 			for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
 				// Find all cells that lay in an exemplary damage band with size 1.5 mm from the y=0 face
 				if ( std::abs( cell->face(face)->center()[enums::x] ) <= parameter.referenceLength/2. )//length_parallel/(4.+2.*double(nbr_local_ref)) )
 				{
 					// @todo Multiple local anisotropic refinements cause DII to fail, Why?
 //						if ( nbr_local_ref==1 || nbr_local_ref==3 || nbr_local_ref==5 || nbr_local_ref==7 ) // even
-						cell->set_refine_flag(RefinementCase<dim>::cut_x); // refine in x and y-direction
+						cell->set_refine_flag(refinement_case);
 //						else
 //							cell->set_refine_flag(RefinementCase<dim>::cut_x); // refine only in the x-direction
 					break;
@@ -746,31 +740,23 @@ namespace tensileSpecimen
 		 }
 		 triangulation.execute_coarsening_and_refinement();
 
-		// Refine innermost part by cut_xy
+		// Refine innermost part
+		// @todo Multiple local anisotropic refinements cause DII to fail, Why?
+		 numEx::RefinementRegion<dim> refinement_region ( triangulation );
 		 for ( unsigned int nbr_local_ref=0; nbr_local_ref < parameter.nbr_holeEdge_refinements; nbr_local_ref++ )
-		 {
-			for (typename Triangulation<dim>::active_cell_iterator
-						 cell = triangulation.begin_active();
-						 cell != triangulation.end(); ++cell)
-			{
-				for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
-					// Find all cells that lay in an exemplary damage band with size 1.5 mm from the y=0 face
-					if ( std::abs( cell->face(face)->center()[enums::x] ) <= 2. )//length_parallel/(4.+2.*double(nbr_local_ref)) )
-					{
-						// @todo Multiple local anisotropic refinements cause DII to fail, Why?
-//						if ( nbr_local_ref==1 || nbr_local_ref==3 || nbr_local_ref==5 || nbr_local_ref==7 ) // even
-							cell->set_refine_flag(RefinementCase<dim>::cut_x); // refine in x and y-direction
-//						else
-//							cell->set_refine_flag(RefinementCase<dim>::cut_x); // refine only in the x-direction
-						break;
-					}
-			}
-			triangulation.execute_coarsening_and_refinement();
-		 }
-
-		// Notch the parallel area in the middle
+			refinement_region.refine( [] ( const typename Triangulation<dim>::active_cell_iterator &cell )
+									  {
+										  for (unsigned int face=0; face<GeometryInfo<dim>::faces_per_cell; ++face)
+											  // Find all cells that lay in an exemplary damage band with size 1.5 mm from the y=0 face
+											  if ( std::abs( cell->face(face)->center()[enums::x] ) <= 2. )//length_parallel/(4.+2.*double(nbr_local_ref)) )
+												  return true;
+										  return false;
+									  },
+									  refinement_case );
+
+		// Notch the parallel area in the middle (moves vertices, so only for serial meshes)
 		 // Find the nodes (plural because of thickness) at x=0 and shift them down by 0.5% of the hwidth_b
-		 if ( false/*notch the tensile specimen*/ )
+		 if ( false/*notch the tensile specimen*/ && !numEx::is_distributed(triangulation) )
 		 {
 			for (typename Triangulation<dim>::active_cell_iterator
 				 cell = triangulation.begin_active();
@@ -782,9 +768,65 @@ namespace tensileSpecimen
 							  cell->vertex(vertex)[enums::y] -= 0.03 * hwidth_b;
 			}
 		 }
+	}
 
-		// Output the triangulation as eps or inp
-		 //numEx::output_triangulation( triangulation, enums::output_eps, numEx_name );
+	/**
+	 * The coarse mesh from \a make_coarse_grid is conforming, the local refinements of the parallel part add hanging nodes.
+	 * - Serial triangulation: The local refinements are anisotropic (cut_x) to keep the cells in the parallel part thin in x-direction only.
+	 * - parallel::distributed::Triangulation: Every rank builds the coarse mesh, which becomes the coarse mesh of p4est.
+	 *   Afterwards, the parallel part is refined on the distributed triangulation.
+	 * - parallel::fullydistributed::Triangulation: Only the first rank builds and refines the mesh, each rank only receives its own cells.
+	 *   Use this for large meshes.
+	 * p4est and the description of the fully distributed triangulation only know isotropic refinements,
+	 * so both distributed variants refine the parallel part isotropically.
+	 */
+	template <int dim>
+	void make_grid( Triangulation<3> &triangulation, const Parameter::GeneralParameters &parameter )
+	{
+		parallel::fullydistributed::Triangulation<dim> *tria_fully_distributed
+			= dynamic_cast< parallel::fullydistributed::Triangulation<dim>* >( &triangulation );
+		if ( tria_fully_distributed != nullptr )
+		{
+			numEx::create_fully_distributed_triangulation<dim>( *tria_fully_distributed,
+																[&] ( Triangulation<dim> &tria_serial )
+																{ make_coarse_grid<dim>( tria_serial, parameter ); },
+																[&] ( Triangulation<dim> &tria_flat )
+																{ refine_parallel_part<dim>( tria_flat, parameter, RefinementCase<dim>::isotropic_refinement ); } );
+			// The description of the mesh only contains the manifold ids
+			 attach_manifolds<dim>( triangulation, parameter );
+			return;
+		}
+
+		// On a distributed triangulation, the coarse mesh is built on an auxiliary serial triangulation
+		 Triangulation<dim> tria_serial;
+		 Triangulation<dim> &tria_coarse = numEx::get_serial_triangulation( triangulation, tria_serial );
+
+		 make_coarse_grid<dim>( tria_coarse, parameter );
+
+		// Hand the conforming coarse mesh to the distributed triangulation, which only partitions it
+		 numEx::distribute_serial_triangulation( tria_coarse, triangulation );
+
+		 refine_parallel_part<dim>( triangulation, parameter,
+									numEx::is_distributed(triangulation) ? RefinementCase<dim>(RefinementCase<dim>::isotropic_refinement)
+																		 : RefinementCase<dim>(RefinementCase<dim>::cut_x) );
+	}
+
+	/**
+	 * Same as \a make_grid, but loads the mesh from the on-disk \a numEx::MeshCache if the same mesh was already generated before
+	 */
+	template <int dim>
+	void make_grid_cached( Triangulation<dim> &triangulation, const Parameter::GeneralParameters &parameter )
+	{
+		numEx::MeshCache<dim> mesh_cache ( numEx_name );
+		mesh_cache.add_to_key( parameter.width ).add_to_key( parameter.height ).add_to_key( parameter.notchWidth )
+				  .add_to_key( parameter.holeRadius ).add_to_key( parameter.thickness ).add_to_key( desired_length )
+				  .add_to_key( parameter.grid_y_repetitions ).add_to_key( parameter.nbr_elementsInZ )
+				  .add_to_key( parameter.nbr_global_refinements ).add_to_key( parameter.nbr_holeEdge_refinements )
+				  .add_to_key( parameter.referenceLength );
+
+		mesh_cache.make_grid( triangulation,
+							  [&] () { make_grid<dim>( triangulation, parameter ); },
+							  [&] () { attach_manifolds<dim>( triangulation, parameter ); } );
 	}
 }
 